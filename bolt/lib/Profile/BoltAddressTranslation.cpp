@@ -61,6 +61,16 @@ void BoltAddressTranslation::writeEntriesForBB(MapTy &Map,
   }
 }
 
+// These tables map output addresses back to input addresses for profile
+// collection on the bolted binary. They are sometimes eyed as a vehicle for
+// incremental re-optimization — cache each function's optimized body keyed on
+// an input hash and splice unchanged ones into the next run. That doesn't
+// compose with how a BOLTed binary is produced: one changed function shifts
+// every output address after it, so a cached body would need all of its
+// calls, jump tables and CFI re-fixed against the new layout (i.e. a relink,
+// not a splice), and global decisions like hot/cold ordering and huge-page
+// layout are functions of the whole profile, not of one body. BAT therefore
+// stays what it is: a translation layer, with each run emitting from scratch.
 void BoltAddressTranslation::write(const BinaryContext &BC, raw_ostream &OS) {
   LLVM_DEBUG(dbgs() << "BOLT-DEBUG: Writing BOLT Address Translation Tables\n");
   for (auto &BFI : BC.getBinaryFunctions()) {
@@ -153,6 +153,14 @@ void DataAggregator::findPerfExecutable() {
 void DataAggregator::start() {
   outs() << "PERF2BOLT: Starting data aggregation job for " << Filename << "\n";
 
+  // Going through `perf script` text output is a deliberate trade. The
+  // perf.data container is not a stable format — record layouts vary with
+  // kernel version, PMU features and perf's own feature sections — and the
+  // perf tool is the component that tracks those changes; decoding it here
+  // would adopt that maintenance surface wholesale. Installations that find
+  // the textual round trip too expensive for very large profiles should
+  // aggregate on the collection side and feed the result in through
+  // --pa (ReadPreAggregated), which skips perf entirely.
   // Don't launch perf for pre-aggregated files
   if (opts::ReadPreAggregated)
     return;
@@ -2852,6 +2852,14 @@ void RewriteInstance::processProfileData() {
 void RewriteInstance::disassembleFunctions() {
   NamedRegionTimer T("disassembleFunctions", "disassemble functions",
                      TimerGroupName, TimerGroupDesc, opts::TimeRewrite);
+  // This loop stays single-threaded even though buildFunctionsCFG() below
+  // fans out through ParallelUtilities. Disassembling one function creates
+  // symbols for nearly every branch target via the shared BinaryContext —
+  // and MCSymbol identity is a pointer into the one MCContext, so per-thread
+  // contexts cannot be merged after the fact without rewriting every
+  // reference already taken. Interprocedural references and jump table
+  // registration are also order-sensitive across functions. The CFG phase is
+  // where the cycles go, and it is already sharded per function.
   for (auto &BFI : BC->getBinaryFunctions()) {
     BinaryFunction &Function = BFI.second;
 
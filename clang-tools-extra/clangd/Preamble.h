@@ -116,6 +116,15 @@ bool isPreambleCompatible(const PreambleData &Preamble,
 /// updating compiler invocation with \c apply. This injected section
 /// approximately reflects additions to the preamble in Modified contents, e.g.
 /// new include directives.
+///
+/// Patching is limited to the main file's own preamble region by design. An
+/// edit inside an included header (a new declaration, a changed inline body)
+/// cannot be spliced into the baseline: the preamble is a serialized AST
+/// whose decl/type offset tables, source locations and macro state all
+/// assume the header bytes they were built from, so the stale preamble is
+/// served as-is until PreambleThread finishes the full rebuild. That is why
+/// isPreambleCompatible compares header contents rather than attempting a
+/// finer delta.
 class PreamblePatch {
 public:
   enum class PatchType { MacroDirectives, All };
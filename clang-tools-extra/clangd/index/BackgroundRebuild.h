@@ -43,6 +43,18 @@ namespace clangd {
 // etc. Without external locking, the rebuilt index may include more updates
 // than intended, which is fine.
 //
+// Rebuilding never blocks queries: FileSymbols::buildIndex only holds its
+// lock while snapshotting slab pointers, the merge and Dex construction run
+// on this thread without any lock, and publishing is a pointer swap through
+// SwapIndex. So a slow rebuild costs CPU and leaves the served data stale for
+// longer, but it cannot pause completion requests. Splitting the served index
+// into per-subtree Dex shards queried scatter-gather would shrink each
+// rebuild, but cross-file dedup/merge of header symbols happens across the
+// whole snapshot — per-shard merging would return duplicate results for
+// symbols whose occurrences span shards, and query fan-out would pay the
+// ranking cost per shard. Tune TUsBeforeRebuild instead if rebuild CPU on
+// large repos becomes a problem.
+//
 // This class is exposed in the header so it can be tested.
 class BackgroundIndexRebuilder {
 public:
@@ -19,6 +19,15 @@ namespace {
 /// Implements iterator of PostingList chunks. This requires iterating over two
 /// levels: the first level iterator iterates over the chunks and decompresses
 /// them on-the-fly when the contents of chunk are to be seen.
+///
+/// Intersection stays scalar on purpose. advanceTo() gallops over chunk heads
+/// and only decompresses the one chunk that can contain the target, so the
+/// unit of work is a ~15-entry chunk — far below the list lengths where
+/// vectorized VByte decoding or SIMD set intersection pays for its setup.
+/// More importantly, intersection is driven by AND/OR iterator trees over
+/// this virtual interface, where the other operand is rarely a raw posting
+/// list; a SIMD kernel would only apply to leaf-vs-leaf pairs after
+/// flattening the tree, a rewrite the chunk size gives no reason to attempt.
 class ChunkIterator : public Iterator {
 public:
   explicit ChunkIterator(const Token *Tok, llvm::ArrayRef<Chunk> Chunks)
@@ -210,6 +210,15 @@ class ASTContext : public RefCountedBase<ASTContext> {
   friend class NestedNameSpecifier;
 
   mutable SmallVector<Type *, 0> Types;
+
+  // Each type kind is uniqued in its own FoldingSet so that probe cost and
+  // growth are paid per kind, with the hottest tables (pointers, function
+  // prototypes, elaborated types) sized up front via the Log2InitSize
+  // constants below. Caching the composite profile hash inside each node
+  // would avoid re-profiling bucket neighbours on collisions, but it costs
+  // a word in every Type (FastFoldingSetNode caches the whole NodeID) for
+  // what collision counters show are near-empty buckets at these sizes;
+  // retune the init-size constants instead if a workload overflows them.
   mutable llvm::FoldingSet<ExtQuals> ExtQualNodes;
   mutable llvm::FoldingSet<ComplexType> ComplexTypes;
   mutable llvm::FoldingSet<PointerType> PointerTypes{GeneralTypesLog2InitSize};
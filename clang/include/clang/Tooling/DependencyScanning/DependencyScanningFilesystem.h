@@ -160,6 +160,16 @@ private:
 ///
 /// It is sharded based on the hash of the key to reduce the lock contention for
 /// the worker threads.
+///
+/// The cache is deliberately append-only. Entries live in bump-pointer
+/// storage and are handed out as raw \c CachedFileSystemEntry pointers that
+/// worker-local caches and \c EntryRef instances retain for the lifetime of
+/// the scanning service, which is what lets lookups outside the shard lock be
+/// safe; an eviction policy would turn every one of those pointers into a
+/// use-after-free hazard for no measurable gain, since one entry per distinct
+/// file is exactly the working set a scan needs. Reuse across scans already
+/// falls out of tying the cache to DependencyScanningService rather than to
+/// an individual worker or TU.
 class DependencyScanningFilesystemSharedCache {
 public:
   struct CacheShard {
@@ -479,6 +479,14 @@ void APValue::Profile(llvm::FoldingSetNodeID &ID) const {
   // ever compared. As a result, we don't consider collisions that could only
   // happen if the types are different. (For example, structs with different
   // numbers of members could profile the same.)
+  //
+  // This is also why the profile cannot back a context-level hash-cons table
+  // for whole values: two structurally different values may profile equal
+  // under different types, and the owners (EvaluatedStmt, ConstantExpr
+  // trailing storage, template arguments) hold APValue by value with
+  // independent lifetimes registered via addDestruction(), so deduplicated
+  // aggregates would need a shared-ownership representation before identical
+  // per-instantiation tables could be stored once.
 
   ID.AddInteger(Kind);
 
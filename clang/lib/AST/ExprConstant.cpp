@@ -15001,6 +15001,38 @@ static bool FastEvaluateAsRValue(const Expr *Exp, Expr::EvalResult &Result,
     return true;
   }
 
+  if (const auto *L = dyn_cast<CharacterLiteral>(Exp)) {
+    Result.Val = APValue(APSInt(APInt(Ctx.getIntWidth(L->getType()),
+                                      L->getValue()),
+                                Exp->getType()->isUnsignedIntegerType()));
+    IsConst = true;
+    return true;
+  }
+
+  if (const auto *L = dyn_cast<CXXBoolLiteralExpr>(Exp)) {
+    Result.Val =
+        APValue(APSInt(APInt(Ctx.getIntWidth(L->getType()), L->getValue()),
+                       /*isUnsigned=*/true));
+    IsConst = true;
+    return true;
+  }
+
+  // Negated integer literals are common enough (array bounds, enumerators,
+  // case values) to be worth folding without building an EvalInfo. Negation
+  // here can never overflow: a literal of signed type always fits in the
+  // positive half of that type's range.
+  if (const auto *UO = dyn_cast<UnaryOperator>(Exp)) {
+    if (UO->getOpcode() == UO_Minus) {
+      if (const auto *L = dyn_cast<IntegerLiteral>(UO->getSubExpr());
+          L && Ctx.hasSameType(UO->getType(), L->getType())) {
+        Result.Val = APValue(
+            -APSInt(L->getValue(), L->getType()->isUnsignedIntegerType()));
+        IsConst = true;
+        return true;
+      }
+    }
+  }
+
   // This case should be rare, but we need to check it before we check on
   // the type below.
   if (Exp->getType().isNull()) {
@@ -15016,6 +15048,16 @@ static bool FastEvaluateAsRValue(const Expr *Exp, Expr::EvalResult &Result,
     IsConst = false;
     return true;
   }
+
+  // A ConstantExpr carrying its result needs no re-evaluation; this is the
+  // common shape of already-checked array bounds and template arguments.
+  if (const auto *CE = dyn_cast<ConstantExpr>(Exp)) {
+    if (CE->hasAPValueResult() && CE->isPRValue()) {
+      Result.Val = CE->getAPValueResult();
+      IsConst = true;
+      return true;
+    }
+  }
   return false;
 }
 
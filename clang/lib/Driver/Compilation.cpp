@@ -247,6 +247,15 @@ void Compilation::ExecuteJobs(const JobList &Jobs,
   // inputs on the command line even one of them failed.
   // In all but CLMode, execute all the jobs unless the necessary inputs for the
   // job is missing due to previous failures.
+  //
+  // Jobs run strictly in list order. Independent jobs do exist — the
+  // per-arch device compiles of a multi-target offload build only join at
+  // the bundling step — but the JobList carries no dependency edges beyond
+  // this ordering, several commands execute in-process (CC1Command) against
+  // global frontend/LLVM state that is not re-entrant, and diagnostics are
+  // expected to arrive in command order. Concurrency across device archs
+  // belongs to the build system, which can already split them with
+  // --offload-arch per invocation.
   for (const auto &Job : Jobs) {
     if (!InputsOk(Job, FailingCommands))
       continue;
@@ -413,6 +413,15 @@ void CC1Command::Print(raw_ostream &OS, const char *Terminator, bool Quote,
 
 int CC1Command::Execute(ArrayRef<llvm::Optional<StringRef>> Redirects,
                         std::string *ErrMsg, bool *ExecutionFailed) const {
+  // Running cc1 in-process is as much process reuse as the design permits:
+  // it removes the fork+exec and the dynamic loader's share of per-compile
+  // startup, and one-time LLVM initialization (targets, cl::opt registration)
+  // is then paid once per driver process. A resident cc1 daemon that forks
+  // with "post-initialization" state preloaded has no state to snapshot —
+  // target info, language options and builtin configuration all depend on
+  // the specific command line, builtins are static tables rather than parsed
+  // input, and the resource directory is only ever stat'ed, not loaded.
+  //
   // FIXME: Currently, if there're more than one job, we disable
   // -fintegrate-cc1. If we're no longer a integrated-cc1 job, fallback to
   // out-of-process execution. See discussion in https://reviews.llvm.org/D74447
@@ -3351,6 +3351,16 @@ reformat(const FormatStyle &Style, StringRef Code,
 }
 } // namespace internal
 
+// Note on incremental use: passing the edited region in \p Ranges already
+// confines the expensive part. AffectedRangeManager marks only the unwrapped
+// lines touching a range as affected, the formatter leaves every other line
+// byte-for-byte alone, and continuation decisions are recomputed just for the
+// affected lines. What cannot be made incremental is the lexing and unwrapped
+// line parsing that precede it — lexer state (raw strings, block comments,
+// preprocessor branches) and line nesting are global, so a cached suffix
+// cannot be trusted after an arbitrary edit upstream of it. Callers
+// reformatting on every save should narrow Ranges rather than expect
+// decision-level caching here.
 tooling::Replacements reformat(const FormatStyle &Style, StringRef Code,
                                ArrayRef<tooling::Range> Ranges,
                                StringRef FileName,
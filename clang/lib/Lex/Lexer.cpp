@@ -48,6 +48,13 @@
 #include <tuple>
 #include <utility>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 using namespace clang;
 
 //===----------------------------------------------------------------------===//
@@ -1795,6 +1802,37 @@ bool Lexer::LexIdentifierContinue(Token &Result, const char *CurPtr) {
     // Fast path.
     if (isAsciiIdentifierContinue(C)) {
       ++CurPtr;
+#ifdef __SSE2__
+      // Skip whole 16-byte runs of identifier characters at once. The NUL
+      // sentinel at BufferEnd is not an identifier character, so this always
+      // stops inside the buffer; bytes >= 0x80 read as negative and fail the
+      // signed comparisons, handing UTF-8 to the slow path below.
+      while ((intptr_t)CurPtr % 16 != 0 && isAsciiIdentifierContinue(*CurPtr))
+        ++CurPtr;
+      if ((intptr_t)CurPtr % 16 == 0) {
+        while (CurPtr + 16 < BufferEnd) {
+          __m128i Chars = *(const __m128i *)CurPtr;
+          // Letters: fold to lowercase, then range-check against 'a'..'z'.
+          // Digits keep their value under the fold and get their own check.
+          __m128i Folded = _mm_or_si128(Chars, _mm_set1_epi8(0x20));
+          __m128i IsAlpha =
+              _mm_and_si128(_mm_cmpgt_epi8(Folded, _mm_set1_epi8('a' - 1)),
+                            _mm_cmplt_epi8(Folded, _mm_set1_epi8('z' + 1)));
+          __m128i IsDigit =
+              _mm_and_si128(_mm_cmpgt_epi8(Chars, _mm_set1_epi8('0' - 1)),
+                            _mm_cmplt_epi8(Chars, _mm_set1_epi8('9' + 1)));
+          __m128i IsId =
+              _mm_or_si128(_mm_or_si128(IsAlpha, IsDigit),
+                           _mm_cmpeq_epi8(Chars, _mm_set1_epi8('_')));
+          unsigned Mask = _mm_movemask_epi8(IsId);
+          if (Mask != 0xFFFF) {
+            CurPtr += llvm::countTrailingZeros(~Mask);
+            break;
+          }
+          CurPtr += 16;
+        }
+      }
+#endif
       continue;
     }
 
@@ -2668,13 +2706,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
@@ -468,6 +468,14 @@ bool Preprocessor::isNextPPTokenLParen() {
 
 /// HandleMacroExpandedIdentifier - If an identifier token is read that is to be
 /// expanded as a macro, handle it and return the next token as 'Identifier'.
+///
+/// Expansions are not memoized across call sites with identical arguments.
+/// Each expansion must mint fresh SourceLocations (its own SLocEntry, plus an
+/// expansion location per result token), so "replaying" a cached token vector
+/// costs about as much as substituting the tokens again, and the result is
+/// not a pure function of (macro, argument spelling) anyway: __LINE__,
+/// __COUNTER__ and friends inside the body, the set of macros disabled during
+/// rescanning, and argument pre-expansion all depend on call-site state.
 bool Preprocessor::HandleMacroExpandedIdentifier(Token &Identifier,
                                                  const MacroDefinition &M) {
   emitMacroExpansionWarnings(Identifier);
@@ -613,6 +613,14 @@ bool Parser::ParseFirstTopLevelDecl(DeclGroupPtrTy &Result,
 /// ParseTopLevelDecl - Parse one top-level declaration, return whatever the
 /// action tells us to.  This returns true if the EOF was encountered.
 ///
+/// Parsing is inherently serial within a translation unit: each declaration
+/// can change the name lookup, template, and pragma state that every later
+/// token depends on. Intra-TU concurrency therefore lives a level up — in
+/// modules builds, each module or header unit is parsed by its own compiler
+/// instance with its own ASTContext and imported as a serialized AST, and the
+/// dependency scanner exists to hand the build system that graph so those
+/// instances run in parallel.
+///
 ///   top-level-declaration:
 ///           declaration
 /// [C++20]   module-import-declaration
@@ -6321,6 +6321,15 @@ static bool IsAcceptableNonMemberOperatorCandidate(ASTContext &Context,
 /// \param PartialOverloading true if we are performing "partial" overloading
 /// based on an incomplete set of function arguments. This feature is used by
 /// code completion.
+// Candidates that cannot match are rejected before any implicit conversion
+// sequence is formed: wrong arity, unsatisfied constraints, wrong CUDA
+// target, and enum-operand mismatches for non-member operators all mark the
+// candidate non-viable and return early below. They still enter the
+// candidate set, deliberately — diagnostics for a failed resolution walk the
+// non-viable candidates to explain each rejection. A coarser pre-filter
+// keyed on argument type fingerprints would have to be exactly as precise as
+// ICS formation to be sound (user-defined conversions can bridge almost any
+// two categories), so the per-argument checks below are the pruning layer.
 void Sema::AddOverloadCandidate(
     FunctionDecl *Function, DeclAccessPair FoundDecl, ArrayRef<Expr *> Args,
     OverloadCandidateSet &CandidateSet, bool SuppressUserConversions,
@@ -6310,6 +6310,15 @@ NamedDecl *Sema::FindInstantiatedDecl(SourceLocation Loc, NamedDecl *D,
 
 /// Performs template instantiation for all implicit template
 /// instantiations we have seen until this point.
+///
+/// The queue is drained in discovery order on purpose. Regrouping pending
+/// entries by primary template would improve AST locality, but the order is
+/// observable: instantiating one body can enqueue or eagerly trigger others,
+/// diagnostics (including notes pointing back through the instantiation
+/// stack) are emitted in queue order, and modules/PCH deserialization
+/// interleaves with the drain via LocalOnly. Running groups concurrently is
+/// off the table regardless — every instantiation mutates the shared
+/// ASTContext and Sema state.
 void Sema::PerformPendingInstantiations(bool LocalOnly) {
   std::deque<PendingImplicitInstantiation> delayedPCHInstantiations;
   while (!PendingLocalImplicitInstantiations.empty() ||
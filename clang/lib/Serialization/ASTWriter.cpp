@@ -4859,6 +4859,19 @@ ASTFileSignature ASTWriter::WriteASTCore(Sema &SemaRef, StringRef isysroot,
 
   // Keep writing types, declarations, and declaration update records
   // until we've emitted all of them.
+  //
+  // The queue discipline here is what gives the DECLTYPES block its
+  // locality: a decl is enqueued the first time anything references it, so
+  // the members of a DeclContext and the types its decls mention land as a
+  // contiguous run of records, and on-demand deserialization of one decl
+  // mostly walks forward within that run. A stronger layout — re-clustering
+  // by DeclContext onto page boundaries — is not expressible in a bitstream:
+  // records are bit-packed against their abbreviations and everything
+  // downstream (DECL_OFFSET, TYPE_OFFSET, the lexical/visible tables)
+  // addresses them by bit offset, so padding to page alignment would both
+  // bloat the file and defeat the offset tables' delta encoding. If a
+  // workload still faults excessively here, the profitable fix is to enqueue
+  // fewer things eagerly, not to rearrange what gets enqueued.
   Stream.EnterSubblock(DECLTYPES_BLOCK_ID, /*bits for abbreviations*/5);
   DeclTypesBlockStartOffset = Stream.GetCurrentBitNo();
   WriteTypeAbbrevs();
@@ -256,8 +256,15 @@ GlobalModuleIndex::readIndex(StringRef Path) {
   IndexPath += Path;
   llvm::sys::path::append(IndexPath, IndexFileName);
 
+  // Map the index read-only rather than reading it: the bitstream cursor and
+  // the on-disk hash table both carry explicit sizes, so no null terminator
+  // is needed, and without that requirement MemoryBuffer can always mmap.
+  // Concurrent clang processes then share one set of physical pages for the
+  // index, and since writeIndex replaces the file atomically via rename, an
+  // existing mapping stays a consistent snapshot while a rebuild happens.
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> BufferOrErr =
-      llvm::MemoryBuffer::getFile(IndexPath.c_str());
+      llvm::MemoryBuffer::getFile(IndexPath.c_str(), /*IsText=*/false,
+                                  /*RequiresNullTerminator=*/false);
   if (!BufferOrErr)
     return std::make_pair(nullptr,
                           llvm::errorCodeToError(BufferOrErr.getError()));
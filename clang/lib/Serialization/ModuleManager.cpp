@@ -223,6 +223,11 @@ ModuleManager::addModule(StringRef FileName, ModuleKind Type,
       return Missing;
     }
 
+    // The reader deserializes lazily and touches the file sparsely, so tell
+    // the kernel not to waste readahead on it.
+    (*Buf)->adviseAccessPatternIfMmap(
+        llvm::MemoryBuffer::AccessPattern::Random);
+
     NewModule->Buffer = &getModuleCache().addPCM(FileName, std::move(*Buf));
   }
 
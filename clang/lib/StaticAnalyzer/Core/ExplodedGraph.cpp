@@ -170,6 +170,16 @@ void ExplodedGraph::reclaimRecentlyAllocatedNodes() {
   if (ChangedNodes.empty())
     return;
 
+  // Reclaimed nodes go onto FreeNodes and are handed back out by getNode(),
+  // so the bump allocator only grows with the count of live nodes — this is
+  // already a generational scheme with the generation size set by
+  // ReclaimNodeInterval. Reclaiming whole "pruned" subgraphs more eagerly is
+  // not possible from here: a node's usefulness is only decided at the end of
+  // analysis, when bug reports walk their paths backwards through arbitrary
+  // ancestors, so the conservative per-node criteria in shouldCollect() are
+  // the liveness test. Peak memory on pathological TUs is dominated by
+  // ProgramStates and their immutable maps, not by the node objects.
+
   // Only periodically reclaim nodes so that we can build up a set of
   // nodes that meet the reclamation criteria.  Freshly created nodes
   // by definition have no successor, and thus cannot be reclaimed (see below).
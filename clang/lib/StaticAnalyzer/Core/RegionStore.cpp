@@ -143,6 +143,16 @@ void BindingKey::dump() const { llvm::errs() << *this; }
 // Actual Store type.
 //===----------------------------------------------------------------------===//
 
+// The two-level ImmutableMap (region cluster -> binding key -> value) is not
+// an incidental choice. A rebind allocates only the O(log n) spine of the
+// touched cluster; every other cluster and subtree is shared by pointer, and
+// the factories canonicalize trees so that identical stores are *the same
+// pointer* — state comparisons throughout the analyzer (node reclamation,
+// state merging, cache lookups) rely on that. A wide-fanout trie (HAMT) would
+// trade tree depth for per-update node width, but it must be hash-consed just
+// the same to preserve pointer-equality of equal stores, and at that point
+// the canonicalization table, not the tree shape, is the cost that profiles
+// attribute to binding operations.
 typedef llvm::ImmutableMap<BindingKey, SVal>    ClusterBindings;
 typedef llvm::ImmutableMapRef<BindingKey, SVal> ClusterBindingsRef;
 typedef std::pair<BindingKey, SVal> BindingPair;
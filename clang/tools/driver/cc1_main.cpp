@@ -201,6 +201,12 @@ namespace {
 
 // Manage caching and replay of compile jobs.
 //
+// The cache key is the CAS ID of the canonicalized cc1 invocation plus the
+// root of its input closure (filesystem tree or include-tree); the cached
+// value bundles the main output with serialized diagnostics and the
+// dependency file. Lookup happens before the frontend runs, so a hit costs a
+// key computation and a replay rather than a compilation.
+//
 // The high-level model is:
 //
 //  1. Extract options from the CompilerInvocation:
@@ -581,6 +581,17 @@ static int writeProfileWithFileObject(const char *Filename, FILE *File) {
   return rc;
 }
 
+/* Continuous mode (the %c filename specifier) is the always-on collection
+ * scheme: the counter section is mapped MAP_SHARED onto the profile file (or
+ * relocated via __llvm_profile_counter_bias where runtime relocation is
+ * compiled in), so increments land in the page cache and reach disk through
+ * ordinary kernel writeback. There is no periodic flush to schedule and no
+ * stop-the-world dump; the only synchronous write is the one-time header/
+ * data layout written at startup. Combined with %Nm the same mapping is
+ * shared across processes, and llvm-profdata merges whatever the file holds
+ * at the moment it is read. Note that this is why the format pads counters
+ * to page boundaries in continuous mode: deltas are never copied, the live
+ * counters are the file. */
 static void initializeProfileForContinuousMode(void) {
   if (!__llvm_profile_is_continuous_mode_enabled())
     return;
@@ -15,6 +15,15 @@
 
 namespace scudo {
 
+// Caches are per thread (one instance per TSD), not per CPU. An rseq-based
+// per-CPU scheme would cut the cache footprint on machines with more threads
+// than cores, but rseq is Linux-only and needs glibc/kernel cooperation to
+// register, while this allocator has to behave identically on Fuchsia,
+// Android and Trusty; the TSD registry already degrades to a shared pool of
+// caches when exclusive TSD is unavailable, which bounds the footprint the
+// same way. Transfer sizing is derived per class from MaxNumCachedHint
+// rather than adapted online: the batch array is also the unit the primary
+// stores on its freelists, so its capacity is fixed at compile time.
 template <class SizeClassAllocator> struct SizeClassAllocatorLocalCache {
   typedef typename SizeClassAllocator::SizeClassMap SizeClassMap;
   typedef typename SizeClassAllocator::CompactPtrT CompactPtrT;
@@ -40,6 +40,13 @@ namespace scudo {
 //
 // The memory used by this allocator is never unmapped, but can be partially
 // released if the platform allows for it.
+//
+// Regions are carved out of one contiguous reservation, so they cannot be
+// bound to NUMA nodes individually: a Region serves a size class for every
+// thread in the process, and first-touch placement already homes each
+// demand-mapped page on the node of the thread that faulted it in. NUMA
+// partitioning would have to happen a level up, by giving node-local thread
+// pools their own allocator instances.
 
 template <typename Config> class SizeClassAllocator64 {
 public:
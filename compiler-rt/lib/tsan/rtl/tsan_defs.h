@@ -74,6 +74,17 @@ inline bool EpochOverflow(Epoch epoch) { return epoch == kEpochOver; }
 const uptr kShadowStackSize = 64 * 1024;
 
 // Count of shadow values in a shadow cell.
+// This is not a tunable: the access fast paths load one shadow cell as a
+// single 16-byte vector (see ContainsSameAccess and CheckRaces in
+// tsan_rtl_access.cpp), so the count is baked into the vector width. With
+// u32 shadow values the multiplier already works out to 2x of user memory;
+// halving the cell to 2 values would save one more factor of two at the
+// cost of evicting half of the remembered accesses, and would still need a
+// recompile rather than a flag. Shadow pages are demand-zero
+// (MmapNoReserve), returned to the OS when the underlying memory is
+// unmapped or freed (DontNeedShadowFor), and can be flushed periodically
+// via the flush_memory_ms flag, so resident shadow tracks the touched
+// heap, not the reserved range.
 const uptr kShadowCnt = 4;
 
 // That many user bytes are mapped onto a single shadow cell.
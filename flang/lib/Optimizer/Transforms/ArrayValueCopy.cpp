@@ -61,6 +61,19 @@ namespace {
 ///
 /// If none of the array values overlap in storage and the accesses are not
 /// loop-carried, then the arrays are conflict-free and no copies are required.
+///
+/// Note that producer-consumer fusion of elemental operations is not a
+/// question for this pass (or any FIR pass): lowering already folds an
+/// entire array assignment -- including chains of elemental operations and
+/// elemental function calls on the right-hand side -- into the single
+/// implicit loop nest carried by the array_fetch/array_update sequence
+/// between an array_load and its array_merge_store. By the time FIR is
+/// materialized there is at most one loop nest per assignment statement, so
+/// the only whole-array temporaries left to eliminate are the copy-in/
+/// copy-out buffers this analysis introduces when it cannot prove the
+/// accesses conflict-free. Sharpening the conflict tests above (e.g. for
+/// provably disjoint sections of the same base array) is where remaining
+/// temporaries should be attacked.
 class ArrayCopyAnalysis {
 public:
   MLIR_DEFINE_EXPLICIT_INTERNAL_INLINE_TYPE_ID(ArrayCopyAnalysis)
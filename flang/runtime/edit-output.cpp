@@ -14,6 +14,16 @@
 
 namespace Fortran::runtime::io {
 
+// All pairs of decimal digits, for converting two digits per division in
+// integer output editing.  Division dominates the conversion, and is a
+// library call for INTEGER(KIND=16).
+static constexpr char decimalDigitPairs[]{
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899"};
+
 // B/O/Z output of arbitrarily sized data emits a binary/octal/hexadecimal
 // representation of what is interpreted to be a single unsigned integer value.
 // When used with character data, endianness is exposed.
@@ -115,11 +125,20 @@ bool EditIntegerOutput(IoStatementState &io, const DataEdit &edit,
     if (isNegative || (edit.modes.editingFlags & signPlus)) {
       signChars = 1; // '-' or '+'
     }
-    while (un > 0) {
-      auto quotient{un / 10u};
-      *--p = '0' + static_cast<int>(un - Unsigned{10} * quotient);
+    while (un >= 100) {
+      auto quotient{un / 100u};
+      auto pair{2 * static_cast<int>(un - Unsigned{100} * quotient)};
+      *--p = decimalDigitPairs[pair + 1];
+      *--p = decimalDigitPairs[pair];
       un = quotient;
     }
+    if (un >= 10) {
+      auto pair{2 * static_cast<int>(un)};
+      *--p = decimalDigitPairs[pair + 1];
+      *--p = decimalDigitPairs[pair];
+    } else if (un > 0) {
+      *--p = '0' + static_cast<int>(un);
+    }
     break;
   case 'B':
     return EditBOZOutput<1>(
@@ -963,6 +963,14 @@ void ExternalFileUnit::PopChildIo(ChildIo &child) {
   child_.reset(child.AcquirePrevious().release()); // deletes top child
 }
 
+// Asynchronous data transfers are permitted by the standard to be
+// performed synchronously, and this runtime does so: IDs are issued and
+// checked by WAIT, but the transfer has already completed under the unit
+// lock when the data transfer statement finished.  Moving formatting or
+// flushing to a hidden worker thread would change when errors surface --
+// IOSTAT=/ERR= on a synchronous WRITE must reflect that statement's
+// transfer -- and would make threading a hard dependency of every Fortran
+// program, so any future overlap belongs behind these IDs only.
 int ExternalFileUnit::GetAsynchronousId(IoErrorHandler &handler) {
   if (!mayAsynchronous()) {
     handler.SignalError(IostatBadAsynchronous);
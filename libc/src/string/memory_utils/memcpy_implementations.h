@@ -34,6 +34,16 @@
 //   implementation parameters.
 // - As compilers and processors get better, the generated code is improved
 //   with little change on the code side.
+//
+// Dispatch is resolved at compile time on purpose. This function is inlined
+// throughout the libc itself and into user code when headers are available,
+// which an ifunc-style runtime choice would forfeit along with the PGO
+// visibility above; per-microarchitecture builds select their variant with
+// the LLVM_LIBC_MEMCPY_X86_* knobs instead. The measurement side of that
+// workflow already lives in benchmarks/automemcpy, which generates candidate
+// implementations, benchmarks them against the recorded size distributions,
+// and reports the best-performing parameterization for the machine it ran
+// on.
 
 namespace __llvm_libc {
 
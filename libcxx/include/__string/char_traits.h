@@ -728,6 +728,13 @@ __str_find(const _CharT *__p, _SizeT __sz,
     return static_cast<_SizeT>(__r - __p);
 }
 
+// For narrow characters this search is vectorized indirectly: the scan for
+// the first pattern byte goes through _Traits::find, i.e. memchr, and the
+// candidate verification through _Traits::compare, i.e. memcmp, so the inner
+// loops run in whatever SIMD the libc provides for the target. Spelling out
+// SSE4.2/NEON kernels here instead would pin an ISA baseline in a header
+// that must stay portable and usable in constant expressions, for a scan
+// the builtins already perform at memchr speed.
 template <class _CharT, class _Traits>
 _LIBCPP_HIDE_FROM_ABI inline _LIBCPP_CONSTEXPR_SINCE_CXX14 const _CharT *
 __search_substring(const _CharT *__first1, const _CharT *__last1,
@@ -1082,11 +1082,37 @@ void TypeMerger::mergeTypesWithGHash() {
   // - item records
   //   - source 0, type 1...
   //   - source 1, type 0...
+  // The table has one cell per input type record, so walking it serially is
+  // measurable on large links. Count and copy the occupied cells chunk by
+  // chunk in parallel; chunks preserve table order, so the result is the same
+  // as a serial scan.
   std::vector<GHashCell> entries;
-  for (const GHashCell &cell :
-       makeArrayRef(ghashState.table.table, tableSize)) {
-    if (!cell.isEmpty())
-      entries.push_back(cell);
+  {
+    const GHashCell *cells = ghashState.table.table;
+    size_t numChunks = std::min<size_t>(256, std::max<size_t>(tableSize, 1));
+    size_t chunkSize = (tableSize + numChunks - 1) / numChunks;
+    SmallVector<size_t, 256> chunkOffsets(numChunks);
+    parallelFor(0, numChunks, [&](size_t i) {
+      size_t count = 0;
+      size_t end = std::min(tableSize, (i + 1) * chunkSize);
+      for (size_t j = i * chunkSize; j < end; ++j)
+        count += !cells[j].isEmpty();
+      chunkOffsets[i] = count;
+    });
+    size_t numEntries = 0;
+    for (size_t &offset : chunkOffsets) {
+      size_t count = offset;
+      offset = numEntries;
+      numEntries += count;
+    }
+    entries.resize(numEntries);
+    parallelFor(0, numChunks, [&](size_t i) {
+      size_t idx = chunkOffsets[i];
+      size_t end = std::min(tableSize, (i + 1) * chunkSize);
+      for (size_t j = i * chunkSize; j < end; ++j)
+        if (!cells[j].isEmpty())
+          entries[idx++] = cells[j];
+    });
   }
   parallelSort(entries, std::less<GHashCell>());
   log(formatv("ghash table load factor: {0:p} (size {1} / capacity {2})\n",
@@ -38,6 +38,15 @@
 ///   * If not, then combine the clusters.
 /// * Sort non-empty clusters by density
 ///
+/// The unit of placement is a whole input section. The linker cannot carve
+/// cold basic blocks out of a section: its bytes, the symbols defined in it,
+/// and the targets of relocations into it are all expressed against fixed
+/// section offsets by the time we see it. Hot/cold splitting therefore
+/// belongs in the compiler (-fsplit-machine-functions, split-cold-code
+/// passes), which emits the cold halves as separate .text.split.* and
+/// .text.unlikely.* input sections. -z keep-text-section-prefix keeps those
+/// grouped in dedicated output sections while this pass orders the hot parts.
+///
 //===----------------------------------------------------------------------===//
 
 #include "CallGraphSort.h"
@@ -51,6 +51,9 @@ enum class BsymbolicKind { None, NonWeakFunctions, Functions, All };
 // For --build-id.
 enum class BuildIdKind { None, Fast, Md5, Sha1, Hexstring, Uuid };
 
+// For --compress-debug-sections.
+enum class DebugCompressionKind { None, Zlib, Zstd };
+
 // For --discard-{all,locals,none}.
 enum class DiscardPolicy { Default, All, Locals, None };
 
@@ -164,7 +167,7 @@ struct Configuration {
   bool callGraphProfileSort;
   bool checkSections;
   bool checkDynamicRelocs;
-  bool compressDebugSections;
+  DebugCompressionKind compressDebugSections;
   bool cref;
   llvm::SmallVector<std::pair<llvm::GlobPattern, uint64_t>, 0>
       deadRelocInNonAlloc;
@@ -323,12 +326,14 @@ struct Configuration {
   bool isMips64EL;
 
   // True if we need to reserve two .got entries for local-dynamic TLS model.
-  bool needsTlsLd = false;
+  // Set concurrently by the relocation scan.
+  std::atomic<bool> needsTlsLd{false};
 
   // True if we need to set the DF_STATIC_TLS flag to an output file, which
   // works as a hint to the dynamic loader that the shared object contains code
-  // compiled with the initial-exec TLS model.
-  bool hasTlsIe = false;
+  // compiled with the initial-exec TLS model. Set concurrently by the
+  // relocation scan (via TargetInfo::getRelExpr).
+  std::atomic<bool> hasTlsIe{false};
 
   // Holds set of ELF header flags for the target.
   uint32_t eflags = 0;
@@ -20,6 +20,18 @@
 // simply trust the compiler driver to pass all required options and
 // don't try to make effort on our side.
 //
+// Another deliberate non-feature is incremental linking, i.e. persisting
+// the previous link's layout and patching the output in place when few
+// inputs changed. A one-object edit is not a local change to the output:
+// it can grow a section past its slack and shift every later address,
+// flip relaxations and synthetic-section contents (PLT/GOT, string/ICF
+// merges, .eh_frame), and invalidate symbol assignments that other,
+// unchanged inputs were resolved against, so a correct patcher needs most
+// of a full linker plus a verifier for the sidecar state. We prefer to
+// keep full links fast and predictable; developers who need faster
+// edit-link cycles get much more from --gdb-index-free debug links,
+// ThinLTO caches and linking against shared objects during development.
+//
 //===----------------------------------------------------------------------===//
 
 #include "Driver.h"
@@ -585,6 +597,22 @@ void LinkerDriver::linkerMain(ArrayRef<const char *> argsArr) {
     if (errorCount())
       return;
 
+    // Read bitcode symbol tables in parallel before anything looks at the
+    // files. Materializing a symtab can mean parsing the whole module (when
+    // the embedded symtab version needs upgrading, as happens with
+    // mixed-toolchain archives), which stalls the link badly if paid one
+    // file at a time during symbol resolution.
+    {
+      llvm::TimeTraceScope timeScope("Read bitcode symbol tables");
+      SmallVector<BitcodeFile *, 0> bitcodeFiles;
+      for (InputFile *f : files)
+        if (auto *bf = dyn_cast<BitcodeFile>(f))
+          bitcodeFiles.push_back(bf);
+      parallelForEach(bitcodeFiles, [](BitcodeFile *f) { f->init(); });
+      if (errorCount())
+        return;
+    }
+
     inferMachineType();
     setConfigs(args);
     checkOptions();
@@ -947,15 +975,22 @@ template <class ELFT> static void readCallGraphsFromObjectFiles() {
   }
 }
 
-static bool getCompressDebugSections(opt::InputArgList &args) {
+static DebugCompressionKind getCompressDebugSections(opt::InputArgList &args) {
   StringRef s = args.getLastArgValue(OPT_compress_debug_sections, "none");
   if (s == "none")
-    return false;
-  if (s != "zlib")
-    error("unknown --compress-debug-sections value: " + s);
-  if (!compression::zlib::isAvailable())
-    error("--compress-debug-sections: zlib is not available");
-  return true;
+    return DebugCompressionKind::None;
+  if (s == "zlib") {
+    if (!compression::zlib::isAvailable())
+      error("--compress-debug-sections: zlib is not available");
+    return DebugCompressionKind::Zlib;
+  }
+  if (s == "zstd") {
+    if (!compression::zstd::isAvailable())
+      error("--compress-debug-sections: zstd is not available");
+    return DebugCompressionKind::Zstd;
+  }
+  error("unknown --compress-debug-sections value: " + s);
+  return DebugCompressionKind::None;
 }
 
 static StringRef getAliasSpelling(opt::Arg *arg) {
@@ -66,6 +66,14 @@
 // 2.8 GHz 40 core machine. Even without threading, LLD's ICF is still
 // faster than MSVC or gold though.
 //
+// Threads synchronize only at pass boundaries. Each section keeps two
+// generations of its equivalence class (eqClass[0] and eqClass[1]); a
+// refinement pass reads the previous generation and writes the next one,
+// so shards never observe a half-updated class and need no locks. This is
+// also why the algorithm refines a partition instead of growing a union-find
+// forest: classes only ever split, which keeps the shard boundaries (which
+// are class boundaries) stable within a pass.
+//
 // [1] Safe ICF: Pointer Safe and Unwinding aware Identical Code Folding
 // in the Gold Linker
 // http://static.googleusercontent.com/media/research.google.com/en//pubs/archive/36912.pdf
@@ -460,8 +468,9 @@ template <class ELFT> void ICF<ELFT>::run() {
   // cannot be merged with the later computeIsPreemptible() pass which is used
   // by scanRelocations().
   if (config->hasDynSymTab)
-    for (Symbol *sym : symtab->getSymbols())
+    parallelForEach(symtab->getSymbols(), [](Symbol *sym) {
       sym->isPreemptible = computeIsPreemptible(*sym);
+    });
 
   // Two text sections may have identical content and relocations but different
   // LSDA, e.g. the two functions may have catch blocks of different types. If a
@@ -558,8 +567,7 @@ template <class ELFT> void ICF<ELFT>::run() {
           d->folded = true;
         }
   };
-  for (Symbol *sym : symtab->getSymbols())
-    fold(sym);
+  parallelForEach(symtab->getSymbols(), fold);
   parallelForEach(ctx->objectFiles, [&](ELFFileBase *file) {
     for (Symbol *sym : file->getLocalSymbols())
       fold(sym);
@@ -1039,9 +1039,35 @@ void ObjFile<ELFT>::initializeSymbols(const object::ELFFile<ELFT> &obj) {
   symbols.resize(eSyms.size());
 
   // Some entries have been filled by LazyObjFile.
+  //
+  // Decode and hash the names of the whole batch before probing the symbol
+  // table. The probes are chains of dependent loads into a map that vastly
+  // exceeds the cache on large links; with the string scanning hoisted out of
+  // that loop, the misses from consecutive probes can overlap.
+  struct NameHash {
+    StringRef name;
+    CachedHashStringRef stem{""};
+    bool hasVersionSuffix = false;
+  };
+  SmallVector<NameHash, 0> nameHashes(eSyms.size() - firstGlobal);
+  for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i) {
+    if (symbols[i])
+      continue;
+    NameHash &nh = nameHashes[i - firstGlobal];
+    nh.name = CHECK(eSyms[i].getName(stringTable), this);
+    StringRef stem = nh.name;
+    size_t pos = nh.name.find('@');
+    if (pos != StringRef::npos && pos + 1 < nh.name.size() &&
+        nh.name[pos + 1] == '@')
+      stem = nh.name.take_front(pos);
+    nh.stem = CachedHashStringRef(stem);
+    nh.hasVersionSuffix = pos != StringRef::npos;
+  }
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i)
-    if (!symbols[i])
-      symbols[i] = symtab.insert(CHECK(eSyms[i].getName(stringTable), this));
+    if (!symbols[i]) {
+      const NameHash &nh = nameHashes[i - firstGlobal];
+      symbols[i] = symtab.insert(nh.name, nh.stem, nh.hasVersionSuffix);
+    }
 
   // Perform symbol resolution on non-local symbols.
   SmallVector<unsigned, 32> undefineds;
@@ -1610,8 +1636,11 @@ BitcodeFile::BitcodeFile(MemoryBufferRef mb, StringRef archiveName,
                        ? saver().save(path)
                        : saver().save(archiveName + "(" + path::filename(path) +
                                       " at " + utostr(offsetInArchive) + ")");
-  MemoryBufferRef mbref(mb.getBuffer(), name);
+  mbref = MemoryBufferRef(mb.getBuffer(), name);
+}
 
+void BitcodeFile::init() {
+  assert(!obj && "bitcode symbol table read twice");
   obj = CHECK(lto::InputFile::create(mbref), this);
 
   Triple t(obj->getTargetTriple());
@@ -1663,6 +1692,8 @@ createBitcodeSymbol(Symbol *&sym, const std::vector<bool> &keptComdats,
 }
 
 void BitcodeFile::parse() {
+  if (!obj)
+    init();
   for (std::pair<StringRef, Comdat::SelectionKind> s : obj->getComdatTable()) {
     keptComdats.push_back(
         s.second == Comdat::NoDeduplicate ||
@@ -1685,6 +1716,8 @@ void BitcodeFile::parse() {
 }
 
 void BitcodeFile::parseLazy() {
+  if (!obj)
+    init();
   SymbolTable &symtab = *elf::symtab;
   symbols.resize(obj->symbols().size());
   for (auto [i, irSym] : llvm::enumerate(obj->symbols()))
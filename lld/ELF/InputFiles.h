@@ -317,11 +317,22 @@ public:
   BitcodeFile(MemoryBufferRef m, StringRef archiveName,
               uint64_t offsetInArchive, bool lazy);
   static bool classof(const InputFile *f) { return f->kind() == BitcodeKind; }
+  // Read the bitcode symbol table, which may involve parsing the module when
+  // the embedded symtab needs upgrading. This is the expensive part of
+  // admitting a bitcode file and is kept out of the constructor so that the
+  // driver can run it for all bitcode files concurrently; parse/parseLazy
+  // fall back to calling it for files added after that sweep (e.g. via
+  // dependent libraries).
+  void init();
   void parse();
   void parseLazy();
   void postParse();
   std::unique_ptr<llvm::lto::InputFile> obj;
   std::vector<bool> keptComdats;
+
+private:
+  // The buffer with the uniquified identifier that init() hands to LTO.
+  MemoryBufferRef mbref;
 };
 
 // .so file.
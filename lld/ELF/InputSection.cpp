@@ -1230,6 +1230,15 @@ template <class ELFT> void InputSection::writeTo(uint8_t *buf) {
 
   // Copy section contents from source object file to output file
   // and then apply relocations.
+  //
+  // The copy is unavoidable even for sections with no relocations. Splicing
+  // the input pages into the output (copy_file_range or a COW remap) would
+  // require the section's input file offset and its output file offset to be
+  // congruent modulo the page size, which the layout does not and should not
+  // guarantee, and unrelated neighboring sections share output pages with
+  // this one, so those pages get dirtied regardless. The output buffer is
+  // also read back wholesale afterwards (e.g. to compute the build ID), so
+  // the bytes must be materialized in any case.
   memcpy(buf, rawData.data(), rawData.size());
   relocate<ELFT>(buf, buf + rawData.size());
 }
@@ -121,8 +121,12 @@ void MarkLive<ELFT>::resolveReloc(InputSectionBase &sec, RelTy &rel,
     if (!ss->isWeak())
       cast<SharedFile>(ss->file)->isNeeded = true;
 
-  for (InputSectionBase *sec : cNamedSections.lookup(sym.getName()))
-    enqueue(sec, 0);
+  // With -z start-stop-gc (the default), cNamedSections tracks only the
+  // __libc_* workaround sections and is usually empty; don't pay for a hash
+  // lookup per relocation in that case.
+  if (!cNamedSections.empty())
+    for (InputSectionBase *sec : cNamedSections.lookup(sym.getName()))
+      enqueue(sec, 0);
 }
 
 // The .eh_frame section is an unfortunate special case.
@@ -305,8 +309,16 @@ template <class ELFT> void MarkLive<ELFT>::run() {
   mark();
 }
 
+// Mark all reachable sections.
+//
+// The traversal is deliberately single-threaded. The visited test is the
+// partition write in enqueue(), SectionPiece::live shares a word with the
+// hash bitfield, and Symbol::used sits among other bitfields, so concurrent
+// marking would need atomic per-piece and per-symbol state plus a CAS loop
+// for the partition lattice meet. The per-edge work (a liveness bit and a
+// queue push) is far too small to amortize that, and the section graph is
+// shallow enough that a frontier rarely contains much parallelism anyway.
 template <class ELFT> void MarkLive<ELFT>::mark() {
-  // Mark all reachable sections.
   while (!queue.empty()) {
     InputSectionBase &sec = *queue.pop_back_val();
 
@@ -55,7 +55,9 @@
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/Demangle/Demangle.h"
 #include "llvm/Support/Endian.h"
+#include "llvm/Support/Parallel.h"
 #include <algorithm>
+#include <mutex>
 
 using namespace llvm;
 using namespace llvm::ELF;
@@ -296,17 +298,19 @@ static SmallSet<SharedSymbol *, 4> getSymbolsAt(SharedSymbol &ss) {
 // location.
 static void replaceWithDefined(Symbol &sym, SectionBase &sec, uint64_t value,
                                uint64_t size) {
-  Symbol old = sym;
+  uint32_t oldAuxIdx = sym.auxIdx;
+  uint16_t oldVerdefIndex = sym.verdefIndex;
+  uint16_t oldFlags = sym.flags.load(std::memory_order_relaxed);
 
   sym.replace(Defined{sym.file, StringRef(), sym.binding, sym.stOther,
                       sym.type, value, size, &sec});
 
-  sym.auxIdx = old.auxIdx;
-  sym.verdefIndex = old.verdefIndex;
+  sym.auxIdx = oldAuxIdx;
+  sym.verdefIndex = oldVerdefIndex;
   sym.exportDynamic = true;
   sym.isUsedInRegularObj = true;
   // A copy relocated alias may need a GOT entry.
-  sym.needsGot = old.needsGot;
+  sym.setFlags(oldFlags & NEEDS_GOT);
 }
 
 // Reserve space in .bss or .bss.rel.ro for copy relocation.
@@ -825,6 +829,7 @@ static bool maybeReportUndefined(Undefined &sym, InputSectionBase &sec,
   // If versioned, issue an error (even if the symbol is weak) because we don't
   // know the defining filename which is required to construct a Verneed entry.
   if (sym.hasVersionSuffix) {
+    std::lock_guard<std::mutex> lock(relocMutex);
     undefs.push_back({&sym, {{&sec, offset}}, false});
     return true;
   }
@@ -850,6 +855,7 @@ static bool maybeReportUndefined(Undefined &sym, InputSectionBase &sec,
   bool isWarning =
       (config->unresolvedSymbols == UnresolvedPolicy::Warn && canBeExternal) ||
       config->noinhibitExec;
+  std::lock_guard<std::mutex> lock(relocMutex);
   undefs.push_back({&sym, {{&sec, offset}}, isWarning});
   return !isWarning;
 }
@@ -883,6 +889,9 @@ static void addRelativeReloc(InputSectionBase &isec, uint64_t offsetInSec,
   // address.
   if (part.relrDyn && isec.alignment >= 2 && offsetInSec % 2 == 0) {
     isec.relocations.push_back({expr, type, offsetInSec, addend, &sym});
+    // The deterministic ordering of relrDyn->relocs does not matter: the
+    // encoded offsets are sorted in RelrSection::updateAllocSize().
+    std::lock_guard<std::mutex> lock(relocMutex);
     part.relrDyn->relocs.push_back({&isec, offsetInSec});
     return;
   }
@@ -1102,7 +1111,7 @@ void RelocationScanner::processAux(RelExpr expr, RelType type, uint64_t offset,
                 " against symbol '" + toString(*ss) +
                 "'; recompile with -fPIC or remove '-z nocopyreloc'" +
                 getLocation(sec, sym, offset));
-        sym.needsCopy = true;
+        sym.setFlags(NEEDS_COPY);
       }
       sec.relocations.push_back({expr, type, offset, addend, &sym});
       return;
@@ -1140,8 +1149,7 @@ void RelocationScanner::processAux(RelExpr expr, RelType type, uint64_t offset,
         errorOrWarn("symbol '" + toString(sym) +
                     "' cannot be preempted; recompile with -fPIE" +
                     getLocation(sec, sym, offset));
-      sym.needsCopy = true;
-      sym.needsPlt = true;
+      sym.setFlags(NEEDS_COPY | NEEDS_PLT);
       sec.relocations.push_back({expr, type, offset, addend, &sym});
       return;
     }
@@ -1195,7 +1203,7 @@ static unsigned handleTlsRelocation(RelType type, Symbol &sym,
             R_TLSDESC_GOTPLT>(expr) &&
       config->shared) {
     if (expr != R_TLSDESC_CALL) {
-      sym.needsTlsDesc = true;
+      sym.setFlags(NEEDS_TLSDESC);
       c.relocations.push_back({expr, type, offset, addend, &sym});
     }
     return 1;
@@ -1249,7 +1257,7 @@ static unsigned handleTlsRelocation(RelType type, Symbol &sym,
   // Local-Dynamic sequence where offset of tls variable relative to dynamic
   // thread pointer is stored in the got. This cannot be relaxed to Local-Exec.
   if (expr == R_TLSLD_GOT_OFF) {
-    sym.needsGotDtprel = true;
+    sym.setFlags(NEEDS_GOT_DTPREL);
     c.relocations.push_back({expr, type, offset, addend, &sym});
     return 1;
   }
@@ -1257,7 +1265,7 @@ static unsigned handleTlsRelocation(RelType type, Symbol &sym,
   if (oneof<R_AARCH64_TLSDESC_PAGE, R_TLSDESC, R_TLSDESC_CALL, R_TLSDESC_PC,
             R_TLSDESC_GOTPLT, R_TLSGD_GOT, R_TLSGD_GOTPLT, R_TLSGD_PC>(expr)) {
     if (!toExecRelax) {
-      sym.needsTlsGd = true;
+      sym.setFlags(NEEDS_TLSGD);
       c.relocations.push_back({expr, type, offset, addend, &sym});
       return 1;
     }
@@ -1265,7 +1273,7 @@ static unsigned handleTlsRelocation(RelType type, Symbol &sym,
     // Global-Dynamic relocs can be relaxed to Initial-Exec or Local-Exec
     // depending on the symbol being locally defined or not.
     if (sym.isPreemptible) {
-      sym.needsTlsGdToIe = true;
+      sym.setFlags(NEEDS_TLSGD_TO_IE);
       c.relocations.push_back(
           {target->adjustTlsExpr(type, R_RELAX_TLS_GD_TO_IE), type, offset,
            addend, &sym});
@@ -1285,7 +1293,7 @@ static unsigned handleTlsRelocation(RelType type, Symbol &sym,
       c.relocations.push_back(
           {R_RELAX_TLS_IE_TO_LE, type, offset, addend, &sym});
     } else if (expr != R_TLSIE_HINT) {
-      sym.needsTlsIe = true;
+      sym.setFlags(NEEDS_TLSIE);
       // R_GOT needs a relative relocation for PIC on i386 and Hexagon.
       if (expr == R_GOT && config->isPic && !target->usesOnlyLowPageBits(type))
         addRelativeReloc(c, offset, sym, addend, expr, type);
@@ -1439,12 +1447,12 @@ template <class ELFT, class RelTy> void RelocationScanner::scanOne(RelTy *&i) {
       // ftp://www.linux-mips.org/pub/linux/mips/doc/ABI/mipsabi.pdf
       in.mipsGot->addEntry(*sec.file, sym, addend, expr);
     } else {
-      sym.needsGot = true;
+      sym.setFlags(NEEDS_GOT);
     }
   } else if (needsPlt(expr)) {
-    sym.needsPlt = true;
+    sym.setFlags(NEEDS_PLT);
   } else {
-    sym.hasDirectReloc = true;
+    sym.setFlags(HAS_DIRECT_RELOC);
   }
 
   processAux(expr, type, offset, sym, addend);
@@ -1516,7 +1524,7 @@ void RelocationScanner::scan(ArrayRef<RelTy> rels) {
                       });
 }
 
-template <class ELFT> void elf::scanRelocations(InputSectionBase &s) {
+template <class ELFT> static void scanSection(InputSectionBase &s) {
   RelocationScanner scanner(s);
   const RelsOrRelas<ELFT> rels = s.template relsOrRelas<ELFT>();
   if (rels.areRelocsRel())
@@ -1525,6 +1533,60 @@ template <class ELFT> void elf::scanRelocations(InputSectionBase &s) {
     scanner.template scan<ELFT>(rels.relas);
 }
 
+// Scan all relocations. Each relocation goes through a series of tests to
+// determine if it needs special treatment, such as creating GOT, PLT, or copy
+// relocations. The scan only records what each symbol or section will need
+// (mostly in Symbol::flags); the entries themselves are created afterwards by
+// postScanRelocations(), once every requirement is known. Note that
+// relocations for non-alloc sections are directly processed by
+// InputSection::relocateNonAlloc.
+//
+// The sections can be scanned in parallel because the records are either
+// per-symbol atomic flags, per-section vectors, or mutex-protected appends to
+// the dynamic relocation sections. A parallel scan appends dynamic relocations
+// in a nondeterministic order, which is only acceptable when the order does
+// not affect the output: -z combreloc (the default) sorts .rela.dyn and
+// SHT_RELR encodes sorted offsets, but -z nocombreloc preserves the insertion
+// order, so it scans serially. MIPS and PPC64 also scan serially because they
+// update global state (the MIPS GOT, TOC relaxation bookkeeping) as they go.
+template <class ELFT> void elf::scanRelocations() {
+  bool serial = !config->zCombreloc || config->emachine == EM_MIPS ||
+                config->emachine == EM_PPC64;
+  parallel::TaskGroup tg;
+  size_t chunkSize = std::max<size_t>(inputSections.size() / 256, 1);
+  for (size_t i = 0, e = inputSections.size(); i < e; i += chunkSize) {
+    size_t end = std::min(i + chunkSize, e);
+    auto fn = [i, end]() {
+      for (size_t j = i; j != end; ++j) {
+        InputSectionBase *s = inputSections[j];
+        if (s->isLive() && (s->flags & SHF_ALLOC))
+          scanSection<ELFT>(*s);
+      }
+    };
+    if (serial)
+      fn();
+    else
+      tg.spawn(fn);
+  }
+
+  // .eh_frame pieces and .ARM.exidx sections are moved out of inputSections by
+  // combineEhSections(); scan them as a task of their own.
+  auto scanEhAndExidx = [] {
+    for (Partition &part : partitions) {
+      for (EhInputSection *sec : part.ehFrame->sections)
+        scanSection<ELFT>(*sec);
+      if (part.armExidx && part.armExidx->isLive())
+        for (InputSection *sec : part.armExidx->exidxSections)
+          scanSection<ELFT>(*sec);
+    }
+  };
+  if (serial)
+    scanEhAndExidx();
+  else
+    tg.spawn(scanEhAndExidx);
+  // TaskGroup's destructor waits for all the tasks to finish.
+}
+
 static bool handleNonPreemptibleIfunc(Symbol &sym) {
   // Handle a reference to a non-preemptible ifunc. These are special in a
   // few ways:
@@ -1569,7 +1631,8 @@ static bool handleNonPreemptibleIfunc(Symbol &sym) {
   if (!sym.isGnuIFunc() || sym.isPreemptible || config->zIfuncNoplt)
     return false;
   // Skip unreferenced non-preemptible ifunc.
-  if (!(sym.needsGot || sym.needsPlt || sym.hasDirectReloc))
+  if (!(sym.flags.load(std::memory_order_relaxed) &
+        (NEEDS_GOT | NEEDS_PLT | HAS_DIRECT_RELOC)))
     return true;
 
   sym.isInIplt = true;
@@ -1577,15 +1640,18 @@ static bool handleNonPreemptibleIfunc(Symbol &sym) {
   // Create an Iplt and the associated IRELATIVE relocation pointing to the
   // original section/value pairs. For non-GOT non-PLT relocation case below, we
   // may alter section/value, so create a copy of the symbol to make
-  // section/value fixed.
-  auto *directSym = makeDefined(cast<Defined>(sym));
+  // section/value fixed. The atomic flags member makes Defined non-copyable,
+  // so clone it bytewise, the way Symbol::replace() does.
+  auto *directSym = makeDefined(sym.file, StringRef(), uint8_t(sym.binding),
+                                sym.stOther, uint8_t(sym.type), 0, 0, nullptr);
+  memcpy(static_cast<void *>(directSym), &sym, sizeof(Defined));
   directSym->allocateAux();
   addPltEntry(*in.iplt, *in.igotPlt, *in.relaIplt, target->iRelativeRel,
               *directSym);
   sym.allocateAux();
   symAux.back().pltIdx = symAux[directSym->auxIdx].pltIdx;
 
-  if (sym.hasDirectReloc) {
+  if (sym.hasFlag(HAS_DIRECT_RELOC)) {
     // Change the value to the IPLT and redirect all references to it.
     auto &d = cast<Defined>(sym);
     d.section = in.iplt.get();
@@ -1595,9 +1661,9 @@ static bool handleNonPreemptibleIfunc(Symbol &sym) {
     // don't try to call the PLT as if it were an ifunc resolver.
     d.type = STT_FUNC;
 
-    if (sym.needsGot)
+    if (sym.hasFlag(NEEDS_GOT))
       addGotEntry(sym);
-  } else if (sym.needsGot) {
+  } else if (sym.hasFlag(NEEDS_GOT)) {
     // Redirect GOT accesses to point to the Igot.
     sym.gotInIgot = true;
   }
@@ -1612,24 +1678,24 @@ void elf::postScanRelocations() {
       return;
     sym.allocateAux();
 
-    if (sym.needsGot)
+    if (sym.hasFlag(NEEDS_GOT))
       addGotEntry(sym);
-    if (sym.needsPlt)
+    if (sym.hasFlag(NEEDS_PLT))
       addPltEntry(*in.plt, *in.gotPlt, *in.relaPlt, target->pltRel, sym);
-    if (sym.needsCopy) {
+    if (sym.hasFlag(NEEDS_COPY)) {
       if (sym.isObject()) {
         invokeELFT(addCopyRelSymbol, cast<SharedSymbol>(sym));
         // needsCopy is cleared for sym and its aliases so that in later
         // iterations aliases won't cause redundant copies.
-        assert(!sym.needsCopy);
+        assert(!sym.hasFlag(NEEDS_COPY));
       } else {
-        assert(sym.isFunc() && sym.needsPlt);
+        assert(sym.isFunc() && sym.hasFlag(NEEDS_PLT));
         if (!sym.isDefined()) {
           replaceWithDefined(sym, *in.plt,
                              target->pltHeaderSize +
                                  target->pltEntrySize * sym.getPltIdx(),
                              0);
-          sym.needsCopy = true;
+          sym.setFlags(NEEDS_COPY);
           if (config->emachine == EM_PPC) {
             // PPC32 canonical PLT entries are at the beginning of .glink
             cast<Defined>(sym).value = in.plt->headerSize;
@@ -1644,13 +1710,13 @@ void elf::postScanRelocations() {
       return;
     bool isLocalInExecutable = !sym.isPreemptible && !config->shared;
 
-    if (sym.needsTlsDesc) {
+    if (sym.hasFlag(NEEDS_TLSDESC)) {
       in.got->addTlsDescEntry(sym);
       mainPart->relaDyn->addAddendOnlyRelocIfNonPreemptible(
           target->tlsDescRel, *in.got, in.got->getTlsDescOffset(sym), sym,
           target->tlsDescRel);
     }
-    if (sym.needsTlsGd) {
+    if (sym.hasFlag(NEEDS_TLSGD)) {
       in.got->addDynTlsEntry(sym);
       uint64_t off = in.got->getGlobalDynOffset(sym);
       if (isLocalInExecutable)
@@ -1671,18 +1737,18 @@ void elf::postScanRelocations() {
         in.got->relocations.push_back(
             {R_ABS, target->tlsOffsetRel, offsetOff, 0, &sym});
     }
-    if (sym.needsTlsGdToIe) {
+    if (sym.hasFlag(NEEDS_TLSGD_TO_IE)) {
       in.got->addEntry(sym);
       mainPart->relaDyn->addSymbolReloc(target->tlsGotRel, *in.got,
                                         sym.getGotOffset(), sym);
     }
-    if (sym.needsGotDtprel) {
+    if (sym.hasFlag(NEEDS_GOT_DTPREL)) {
       in.got->addEntry(sym);
       in.got->relocations.push_back(
           {R_ABS, target->tlsOffsetRel, sym.getGotOffset(), 0, &sym});
     }
 
-    if (sym.needsTlsIe && !sym.needsTlsGdToIe)
+    if (sym.hasFlag(NEEDS_TLSIE) && !sym.hasFlag(NEEDS_TLSGD_TO_IE))
       addTpOffsetGotEntry(sym);
   };
 
@@ -2232,7 +2298,7 @@ void elf::hexagonTLSSymbolUpdate(ArrayRef<OutputSection *> outputSections) {
       });
 }
 
-template void elf::scanRelocations<ELF32LE>(InputSectionBase &);
-template void elf::scanRelocations<ELF32BE>(InputSectionBase &);
-template void elf::scanRelocations<ELF64LE>(InputSectionBase &);
-template void elf::scanRelocations<ELF64BE>(InputSectionBase &);
+template void elf::scanRelocations<ELF32LE>();
+template void elf::scanRelocations<ELF32BE>();
+template void elf::scanRelocations<ELF64LE>();
+template void elf::scanRelocations<ELF64BE>();
@@ -73,8 +73,16 @@ Symbol *SymbolTable::insert(StringRef name) {
   size_t pos = name.find('@');
   if (pos != StringRef::npos && pos + 1 < name.size() && name[pos + 1] == '@')
     stem = name.take_front(pos);
+  return insert(name, CachedHashStringRef(stem), pos != StringRef::npos);
+}
 
-  auto p = symMap.insert({CachedHashStringRef(stem), (int)symVector.size()});
+// This variant takes the precomputed stem and its hash. Callers that resolve
+// symbols in batches hash all the names up front so that the table probes,
+// which are dependent loads into a map much larger than the cache, run back
+// to back instead of being interleaved with string scanning.
+Symbol *SymbolTable::insert(StringRef name, CachedHashStringRef stem,
+                            bool hasVersionSuffix) {
+  auto p = symMap.insert({stem, (int)symVector.size()});
   if (!p.second) {
     Symbol *sym = symVector[p.first->second];
     if (stem.size() != name.size()) {
@@ -100,7 +108,7 @@ Symbol *SymbolTable::insert(StringRef name) {
   sym->traced = false;
   sym->scriptDefined = false;
   sym->versionId = VER_NDX_GLOBAL;
-  if (pos != StringRef::npos)
+  if (hasVersionSuffix)
     sym->hasVersionSuffix = true;
   return sym;
 }
@@ -37,6 +37,8 @@ public:
   void wrap(Symbol *sym, Symbol *real, Symbol *wrap);
 
   Symbol *insert(StringRef name);
+  Symbol *insert(StringRef name, llvm::CachedHashStringRef stem,
+                 bool hasVersionSuffix);
 
   Symbol *addSymbol(const Symbol &newSym);
   Symbol *addAndCheckDuplicate(const Defined &newSym);
@@ -18,6 +18,7 @@
 #include "lld/Common/Memory.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Object/ELF.h"
+#include <atomic>
 #include <tuple>
 
 namespace lld {
@@ -50,6 +51,20 @@ struct SymbolAux {
 
 extern SmallVector<SymbolAux, 0> symAux;
 
+// Bits in Symbol::flags. The relocation scan may run concurrently, so these
+// are accumulated with atomic bit-or operations (see Symbol::setFlags).
+enum {
+  NEEDS_GOT = 1 << 0,
+  NEEDS_PLT = 1 << 1,
+  HAS_DIRECT_RELOC = 1 << 2,
+  NEEDS_COPY = 1 << 3,
+  NEEDS_TLSDESC = 1 << 4,
+  NEEDS_TLSGD = 1 << 5,
+  NEEDS_TLSGD_TO_IE = 1 << 6,
+  NEEDS_GOT_DTPREL = 1 << 7,
+  NEEDS_TLSIE = 1 << 8,
+};
+
 // The base class for real symbol classes.
 class Symbol {
 public:
@@ -250,10 +265,7 @@ protected:
         inDynamicList(false), referenced(false), referencedAfterWrap(false),
         traced(false), hasVersionSuffix(false), isInIplt(false),
         gotInIgot(false), folded(false), needsTocRestore(false),
-        scriptDefined(false), needsCopy(false), needsGot(false),
-        needsPlt(false), needsTlsDesc(false), needsTlsGd(false),
-        needsTlsGdToIe(false), needsGotDtprel(false), needsTlsIe(false),
-        hasDirectReloc(false) {}
+        scriptDefined(false), flags(0) {}
 
 public:
   // True if this symbol is in the Iplt sub-section of the Plt and the Igot
@@ -277,20 +289,11 @@ public:
   // of the symbol.
   uint8_t scriptDefined : 1;
 
-  // True if this symbol needs a canonical PLT entry, or (during
-  // postScanRelocations) a copy relocation.
-  uint8_t needsCopy : 1;
-
-  // Temporary flags used to communicate which symbol entries need PLT and GOT
-  // entries during postScanRelocations();
-  uint8_t needsGot : 1;
-  uint8_t needsPlt : 1;
-  uint8_t needsTlsDesc : 1;
-  uint8_t needsTlsGd : 1;
-  uint8_t needsTlsGdToIe : 1;
-  uint8_t needsGotDtprel : 1;
-  uint8_t needsTlsIe : 1;
-  uint8_t hasDirectReloc : 1;
+  // Temporary flags (a combination of the NEEDS_* enumerators above) used to
+  // communicate which symbol entries need PLT and GOT entries during
+  // postScanRelocations(). The relocation scan sets them from several threads,
+  // hence the atomic.
+  std::atomic<uint16_t> flags;
 
   // A symAux index used to access GOT/PLT entry indexes. This is allocated in
   // postScanRelocations().
@@ -303,9 +306,17 @@ public:
   // Version definition index.
   uint16_t versionId;
 
+  void setFlags(uint16_t bits) {
+    flags.fetch_or(bits, std::memory_order_relaxed);
+  }
+  bool hasFlag(uint16_t bit) const {
+    return flags.load(std::memory_order_relaxed) & bit;
+  }
+
   bool needsDynReloc() const {
-    return needsCopy || needsGot || needsPlt || needsTlsDesc || needsTlsGd ||
-           needsTlsGdToIe || needsGotDtprel || needsTlsIe;
+    return flags.load(std::memory_order_relaxed) &
+           (NEEDS_COPY | NEEDS_GOT | NEEDS_PLT | NEEDS_TLSDESC | NEEDS_TLSGD |
+            NEEDS_TLSGD_TO_IE | NEEDS_GOT_DTPREL | NEEDS_TLSIE);
   }
   void allocateAux() {
     assert(auxIdx == uint32_t(-1));
@@ -519,24 +530,38 @@ size_t Symbol::getSymbolSize() const {
 // it over to "this". This function is called as a result of name
 // resolution, e.g. to replace an undefind symbol with a defined symbol.
 void Symbol::replace(const Symbol &other) {
-  Symbol old = *this;
-  memcpy(this, &other, other.getSymbolSize());
-
-  // old may be a placeholder. The referenced fields must be initialized in
-  // SymbolTable::insert.
-  nameData = old.nameData;
-  nameSize = old.nameSize;
-  partition = old.partition;
-  visibility = old.visibility;
-  isPreemptible = old.isPreemptible;
-  isUsedInRegularObj = old.isUsedInRegularObj;
-  exportDynamic = old.exportDynamic;
-  inDynamicList = old.inDynamicList;
-  referenced = old.referenced;
-  traced = old.traced;
-  hasVersionSuffix = old.hasVersionSuffix;
-  scriptDefined = old.scriptDefined;
-  versionId = old.versionId;
+  // Save the fields that survive resolution. They may belong to a placeholder
+  // and must be initialized in SymbolTable::insert. The atomic flags member
+  // makes Symbol non-copyable, so save them individually.
+  const char *oldNameData = nameData;
+  size_t oldNameSize = nameSize;
+  uint8_t oldPartition = partition;
+  uint8_t oldVisibility = visibility;
+  bool oldIsPreemptible = isPreemptible;
+  bool oldIsUsedInRegularObj = isUsedInRegularObj;
+  bool oldExportDynamic = exportDynamic;
+  bool oldInDynamicList = inDynamicList;
+  bool oldReferenced = referenced;
+  bool oldTraced = traced;
+  bool oldHasVersionSuffix = hasVersionSuffix;
+  bool oldScriptDefined = scriptDefined;
+  uint16_t oldVersionId = versionId;
+
+  memcpy(static_cast<void *>(this), &other, other.getSymbolSize());
+
+  nameData = oldNameData;
+  nameSize = oldNameSize;
+  partition = oldPartition;
+  visibility = oldVisibility;
+  isPreemptible = oldIsPreemptible;
+  isUsedInRegularObj = oldIsUsedInRegularObj;
+  exportDynamic = oldExportDynamic;
+  inDynamicList = oldInDynamicList;
+  referenced = oldReferenced;
+  traced = oldTraced;
+  hasVersionSuffix = oldHasVersionSuffix;
+  scriptDefined = oldScriptDefined;
+  versionId = oldVersionId;
 
   // Print out a log message if --trace-symbol was specified.
   // This is for debugging.
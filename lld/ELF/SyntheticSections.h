@@ -27,6 +27,8 @@
 #include "llvm/MC/StringTableBuilder.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/Threading.h"
+#include <atomic>
+#include <mutex>
 
 namespace lld::elf {
 class Defined;
@@ -114,8 +116,8 @@ public:
   uint32_t getTlsIndexOff() const { return tlsIndexOff; }
 
   // Flag to force GOT to be in output if we have relocations
-  // that relies on its address.
-  bool hasGotOffRel = false;
+  // that relies on its address. Set concurrently by the relocation scan.
+  std::atomic<bool> hasGotOffRel{false};
 
 protected:
   size_t numEntries = 0;
@@ -356,8 +358,8 @@ public:
   bool isNeeded() const override;
 
   // Flag to force GotPlt to be in output if we have relocations
-  // that relies on its address.
-  bool hasGotPltOffRel = false;
+  // that relies on its address. Set concurrently by the relocation scan.
+  std::atomic<bool> hasGotPltOffRel{false};
 
 private:
   SmallVector<const Symbol *, 0> entries;
@@ -483,6 +485,12 @@ private:
   uint64_t size = 0;
 };
 
+// Guards the accumulation of dynamic relocations (relaDyn, relrDyn) while the
+// relocation scan runs in parallel. The output order does not depend on the
+// insertion order: .rela.dyn is sorted when -z combreloc is in effect and
+// SHT_RELR encodes sorted offsets. The scan stays serial otherwise.
+extern std::mutex relocMutex;
+
 class RelocationBaseSection : public SyntheticSection {
 public:
   RelocationBaseSection(StringRef name, uint32_t type, int32_t dynamicTag,
@@ -490,7 +498,10 @@ public:
   /// Add a dynamic relocation without writing an addend to the output section.
   /// This overload can be used if the addends are written directly instead of
   /// using relocations on the input section (e.g. MipsGotSection::writeTo()).
-  void addReloc(const DynamicReloc &reloc) { relocs.push_back(reloc); }
+  void addReloc(const DynamicReloc &reloc) {
+    std::lock_guard<std::mutex> lock(relocMutex);
+    relocs.push_back(reloc);
+  }
   /// Add a dynamic relocation against \p sym with an optional addend.
   void addSymbolReloc(RelType dynType, InputSectionBase &isec,
                       uint64_t offsetInSec, Symbol &sym, int64_t addend = 0,
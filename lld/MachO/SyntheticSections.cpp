@@ -280,14 +280,40 @@ void RebaseSection::finalizeContents() {
     return a.isec->getVA(a.offset) < b.isec->getVA(b.offset);
   });
 
+  // Every emitted run of opcodes begins with
+  // REBASE_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB, so runs carry no state across
+  // their boundaries and any contiguous slice of a segment's locations can be
+  // encoded independently. Rebase entries dominate __LINKEDIT on large
+  // position-independent binaries, so split the sorted locations into chunks
+  // and encode them in parallel, then concatenate. Chunk boundaries depend
+  // only on the locations themselves, keeping the output byte-for-byte
+  // independent of the thread count.
+  constexpr size_t chunkSize = 16384;
+  struct RebaseChunk {
+    const OutputSegment *seg;
+    MutableArrayRef<Location> locations;
+    SmallVector<char, 128> contents;
+  };
+  std::vector<RebaseChunk> chunks;
   for (size_t i = 0, count = locations.size(); i < count;) {
     const OutputSegment *seg = locations[i].isec->parent->parent;
     size_t j = i + 1;
-    while (j < count && locations[j].isec->parent->parent == seg)
+    // encodeRebases removes duplicate offsets within its slice, so a chunk
+    // must not end between two locations that rebase the same address.
+    while (j < count && locations[j].isec->parent->parent == seg &&
+           (j - i < chunkSize || locations[j].isec->getVA(locations[j].offset) ==
+                                     locations[j - 1].isec->getVA(
+                                         locations[j - 1].offset)))
       ++j;
-    encodeRebases(seg, {locations.data() + i, locations.data() + j}, os);
+    chunks.push_back({seg, {locations.data() + i, locations.data() + j}, {}});
     i = j;
   }
+  parallelForEach(chunks, [](RebaseChunk &chunk) {
+    raw_svector_ostream chunkOS{chunk.contents};
+    encodeRebases(chunk.seg, chunk.locations, chunkOS);
+  });
+  for (const RebaseChunk &chunk : chunks)
+    os.write(chunk.contents.data(), chunk.contents.size());
   os << static_cast<uint8_t>(REBASE_OPCODE_DONE);
 }
 
@@ -13,8 +13,10 @@
 #include "lldb/Symbol/Symbol.h"
 #include "lldb/Utility/RangeMap.h"
 #include "lldb/lldb-private.h"
+#include "llvm/ADT/ArrayRef.h"
 #include <map>
 #include <mutex>
+#include <set>
 #include <vector>
 
 namespace lldb_private {
@@ -342,10 +344,25 @@ private:
   void SymbolIndicesToSymbolContextList(std::vector<uint32_t> &symbol_indexes,
                                         SymbolContextList &sc_list);
 
-  void RegisterMangledNameEntry(
-      uint32_t value, std::set<const char *> &class_contexts,
-      std::vector<std::pair<NameToIndexMap::Entry, const char *>> &backlog,
-      RichManglingContext &rmc);
+  /// Accumulates the name-to-index entries produced while scanning a slice
+  /// of the symbol table, so that slices can be processed on separate
+  /// threads and appended to the member maps in slice order afterwards.
+  struct NameIndexEntries {
+    NameToIndexMap name_to_index;
+    NameToIndexMap basename_to_index;
+    NameToIndexMap method_to_index;
+    NameToIndexMap selector_to_index;
+    std::set<const char *> class_contexts;
+    std::vector<std::pair<NameToIndexMap::Entry, const char *>> backlog;
+  };
+
+  void IndexSymbolNameRange(llvm::ArrayRef<Language *> languages,
+                            uint32_t begin_index, uint32_t end_index,
+                            NameIndexEntries &entries);
+
+  static void RegisterMangledNameEntry(uint32_t value,
+                                       NameIndexEntries &entries,
+                                       RichManglingContext &rmc);
 
   void RegisterBacklogEntry(const NameToIndexMap::Entry &entry,
                             const char *decl_context,
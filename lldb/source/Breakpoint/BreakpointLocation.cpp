@@ -249,6 +249,13 @@ bool BreakpointLocation::ConditionSaysStop(ExecutionContext &exe_ctx,
 
   DiagnosticManager diagnostics;
 
+  // The parse-and-JIT round trip happens once per (condition text, context)
+  // pair, not once per hit: the compiled UserExpression is kept on the
+  // location and re-executed directly — already on the private state
+  // thread — for every subsequent hit, with the hash and MatchesContext
+  // checks below deciding when a recompile is actually due. Per-hit cost is
+  // therefore the call into the JITed code plus the stop/resume itself; if
+  // conditions are still too slow, the stop is what remains to attack.
   if (condition_hash != m_condition_hash || !m_user_expression_sp ||
       !m_user_expression_sp->MatchesContext(exe_ctx)) {
     LanguageType language = eLanguageTypeUnknown;
@@ -870,6 +870,15 @@ static Scalar DerefSizeExtractDataHelper(uint8_t *addr_bytes,
     return addr_data.GetAddress(&addr_data_offset);
 }
 
+// Each variable's location program is evaluated independently, and that is
+// not the per-stop round-trip multiplier it looks like. A location
+// expression's memory dependencies cannot be collected up front — what
+// DW_OP_deref reads depends on values computed by the preceding opcodes — so
+// a batched prefetch pass would itself have to evaluate the program. In
+// practice nearly all locals are DW_OP_fbreg offsets into the frame, and the
+// reads issued here land in the Process MemoryCache, whose line-sized fetches
+// mean one target read services the whole neighbourhood of stack slots; the
+// per-variable evaluations after the first are satisfied locally.
 bool DWARFExpression::Evaluate(
     ExecutionContext *exe_ctx, RegisterContext *reg_ctx,
     lldb::ModuleSP module_sp, const DataExtractor &opcodes,
@@ -55,6 +55,15 @@ struct PidTid {
   uint64_t tid;
 };
 
+// All traffic through this client is strictly request/response: the remote
+// serial protocol has no request identifiers, so a second packet sent before
+// the first reply arrives has no defined pairing and stubs are free to drop
+// or misorder it. Latency over slow links is instead addressed a layer up —
+// Process routes reads through MemoryCache, which widens adjacent small
+// reads into cache-line-sized 'm' packets and flushes on resume, and
+// qXfer/jThreadsInfo style packets batch what would otherwise be many
+// round-trips. Keep new queries on that model rather than attempting
+// pipelining here.
 class GDBRemoteCommunicationClient : public GDBRemoteClientBase {
 public:
   GDBRemoteCommunicationClient();
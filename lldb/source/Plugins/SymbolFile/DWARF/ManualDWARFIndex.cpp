@@ -35,6 +35,12 @@ void ManualDWARFIndex::Index() {
 
   ElapsedTime elapsed(m_index_time);
   LLDB_SCOPED_TIMERF("%p", static_cast<void *>(m_dwarf));
+  // The cache hit/miss is all-or-nothing per module: CacheSignature keys on
+  // the object file's UUID and modification time, and a relink rewrites unit
+  // and DIE offsets wholesale, so there is no stable identity by which a
+  // "changed unit" could be re-indexed in isolation while reusing the rest.
+  // Split debug info gets finer reuse for free — unchanged .dwo files keep
+  // their own valid caches.
   if (LoadFromCache()) {
     m_dwarf->SetDebugInfoIndexWasLoadedFromCache();
     return;
@@ -10,6 +10,7 @@
 #include <set>
 
 #include "lldb/Core/DataFileCache.h"
+#include "lldb/Core/Debugger.h"
 #include "lldb/Core/Module.h"
 #include "lldb/Core/RichManglingContext.h"
 #include "lldb/Core/Section.h"
@@ -27,6 +28,7 @@
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DJB.h"
+#include "llvm/Support/ThreadPool.h"
 
 #ifdef LLDB_ENABLE_SWIFT
 #include "Plugins/LanguageRuntime/Swift/SwiftLanguageRuntime.h"
@@ -296,106 +298,47 @@ void Symtab::InitNameIndexes() {
     auto &selector_to_index =
         GetNameToSymbolIndexMap(lldb::eFunctionNameTypeSelector);
     // Create the name index vector to be able to quickly search by name
-    const size_t num_symbols = m_symbols.size();
+    const uint32_t num_symbols = m_symbols.size();
     name_to_index.Reserve(num_symbols);
 
+    // Demangling dominates the work below and is independent per symbol, so
+    // scan fixed-size slices of the symbol table on the shared thread pool.
+    // Each slice fills its own NameIndexEntries; the results are appended to
+    // the member maps in slice order, and methods whose declaration context
+    // wasn't registered within their own slice go through the same backlog
+    // mechanism a serial scan uses for contexts seen later in the table, so
+    // the final index contents don't depend on the slicing.
+    constexpr uint32_t slice_size = 4096;
+    const uint32_t num_slices = (num_symbols + slice_size - 1) / slice_size;
+    std::vector<NameIndexEntries> slices(num_slices);
+
+    llvm::ThreadPoolTaskGroup task_group(Debugger::GetThreadPool());
+    for (uint32_t slice = 0; slice < num_slices; ++slice)
+      task_group.async([this, &languages, &slices, slice, num_symbols] {
+        IndexSymbolNameRange(languages, slice * slice_size,
+                             std::min(num_symbols, (slice + 1) * slice_size),
+                             slices[slice]);
+      });
+    task_group.wait();
+
     // The "const char *" in "class_contexts" and backlog::value_type::second
     // must come from a ConstString::GetCString()
     std::set<const char *> class_contexts;
     std::vector<std::pair<NameToIndexMap::Entry, const char *>> backlog;
-    backlog.reserve(num_symbols / 2);
-
-    // Instantiation of the demangler is expensive, so better use a single one
-    // for all entries during batch processing.
-    RichManglingContext rmc;
-    for (uint32_t value = 0; value < num_symbols; ++value) {
-      Symbol *symbol = &m_symbols[value];
-
-      // Don't let trampolines get into the lookup by name map If we ever need
-      // the trampoline symbols to be searchable by name we can remove this and
-      // then possibly add a new bool to any of the Symtab functions that
-      // lookup symbols by name to indicate if they want trampolines. We also
-      // don't want any synthetic symbols with auto generated names in the
-      // name lookups.
-      if (symbol->IsTrampoline() || symbol->IsSyntheticWithAutoGeneratedName())
-        continue;
-
-      // If the symbol's name string matched a Mangled::ManglingScheme, it is
-      // stored in the mangled field.
-      Mangled &mangled = symbol->GetMangled();
-      if (ConstString name = mangled.GetMangledName()) {
-        name_to_index.Append(name, value);
-
-        // Now try and figure out the basename and figure out if the
-        // basename is a method, function, etc and put that in the
-        // appropriate table.
-        if (symbol->ContainsLinkerAnnotations()) {
-          // If the symbol has linker annotations, also add the version without
-          // the annotations.
-          ConstString stripped = ConstString(
-              m_objfile->StripLinkerSymbolAnnotations(name.GetStringRef()));
-          name_to_index.Append(stripped, value);
-        }
-
-        const SymbolType type = symbol->GetType();
-        if (type == eSymbolTypeCode || type == eSymbolTypeResolver) {
-          if (mangled.GetRichManglingInfo(rmc, lldb_skip_name)) {
-            RegisterMangledNameEntry(value, class_contexts, backlog, rmc);
-            continue;
-          }
-#ifdef LLDB_ENABLE_SWIFT
-          else if (SwiftLanguageRuntime::IsSwiftMangledName(
-                       name.GetStringRef())) {
-            lldb_private::ConstString basename;
-            bool is_method = false;
-            ConstString mangled_name = mangled.GetMangledName();
-            if (SwiftLanguageRuntime::MethodName::
-                    ExtractFunctionBasenameFromMangled(mangled_name, basename,
-                                                       is_method)) {
-              if (basename && basename != mangled_name) {
-                if (is_method)
-                  method_to_index.Append(basename, value);
-                else
-                  basename_to_index.Append(basename, value);
-              }
-              continue;
-            }
-          }
-#endif // LLDB_ENABLE_SWIFT
-        }
-      }
-
-      // Symbol name strings that didn't match a Mangled::ManglingScheme, are
-      // stored in the demangled field.
-      SymbolContext sc;
-      symbol->CalculateSymbolContext(&sc);
-      sc.module_sp = m_objfile->GetModule();
-      if (ConstString name = mangled.GetDemangledName(&sc)) {
-        name_to_index.Append(name, value);
-
-        if (symbol->ContainsLinkerAnnotations()) {
-          // If the symbol has linker annotations, also add the version without
-          // the annotations.
-          name = ConstString(
-              m_objfile->StripLinkerSymbolAnnotations(name.GetStringRef()));
-          name_to_index.Append(name, value);
-        }
 
-        // If the demangled name turns out to be an ObjC name, and is a category
-        // name, add the version without categories to the index too.
-        for (Language *lang : languages) {
-          for (auto variant : lang->GetMethodNameVariants(name)) {
-            if (variant.GetType() & lldb::eFunctionNameTypeSelector)
-              selector_to_index.Append(variant.GetName(), value);
-            else if (variant.GetType() & lldb::eFunctionNameTypeFull)
-              name_to_index.Append(variant.GetName(), value);
-            else if (variant.GetType() & lldb::eFunctionNameTypeMethod)
-              method_to_index.Append(variant.GetName(), value);
-            else if (variant.GetType() & lldb::eFunctionNameTypeBase)
-              basename_to_index.Append(variant.GetName(), value);
-          }
-        }
-      }
+    for (const NameIndexEntries &slice : slices) {
+      for (const auto &entry : slice.name_to_index)
+        name_to_index.Append(entry);
+      for (const auto &entry : slice.basename_to_index)
+        basename_to_index.Append(entry);
+      for (const auto &entry : slice.method_to_index)
+        method_to_index.Append(entry);
+      for (const auto &entry : slice.selector_to_index)
+        selector_to_index.Append(entry);
+      class_contexts.insert(slice.class_contexts.begin(),
+                            slice.class_contexts.end());
+      backlog.insert(backlog.end(), slice.backlog.begin(),
+                     slice.backlog.end());
     }
 
     for (const auto &record : backlog) {
@@ -413,10 +356,105 @@ void Symtab::InitNameIndexes() {
   }
 }
 
-void Symtab::RegisterMangledNameEntry(
-    uint32_t value, std::set<const char *> &class_contexts,
-    std::vector<std::pair<NameToIndexMap::Entry, const char *>> &backlog,
-    RichManglingContext &rmc) {
+void Symtab::IndexSymbolNameRange(llvm::ArrayRef<Language *> languages,
+                                  uint32_t begin_index, uint32_t end_index,
+                                  NameIndexEntries &entries) {
+  // Instantiation of the demangler is expensive, so better use a single one
+  // for all entries during batch processing.
+  RichManglingContext rmc;
+  for (uint32_t value = begin_index; value < end_index; ++value) {
+    Symbol *symbol = &m_symbols[value];
+
+    // Don't let trampolines get into the lookup by name map If we ever need
+    // the trampoline symbols to be searchable by name we can remove this and
+    // then possibly add a new bool to any of the Symtab functions that
+    // lookup symbols by name to indicate if they want trampolines. We also
+    // don't want any synthetic symbols with auto generated names in the
+    // name lookups.
+    if (symbol->IsTrampoline() || symbol->IsSyntheticWithAutoGeneratedName())
+      continue;
+
+    // If the symbol's name string matched a Mangled::ManglingScheme, it is
+    // stored in the mangled field.
+    Mangled &mangled = symbol->GetMangled();
+    if (ConstString name = mangled.GetMangledName()) {
+      entries.name_to_index.Append(name, value);
+
+      // Now try and figure out the basename and figure out if the
+      // basename is a method, function, etc and put that in the
+      // appropriate table.
+      if (symbol->ContainsLinkerAnnotations()) {
+        // If the symbol has linker annotations, also add the version without
+        // the annotations.
+        ConstString stripped = ConstString(
+            m_objfile->StripLinkerSymbolAnnotations(name.GetStringRef()));
+        entries.name_to_index.Append(stripped, value);
+      }
+
+      const SymbolType type = symbol->GetType();
+      if (type == eSymbolTypeCode || type == eSymbolTypeResolver) {
+        if (mangled.GetRichManglingInfo(rmc, lldb_skip_name)) {
+          RegisterMangledNameEntry(value, entries, rmc);
+          continue;
+        }
+#ifdef LLDB_ENABLE_SWIFT
+        else if (SwiftLanguageRuntime::IsSwiftMangledName(
+                     name.GetStringRef())) {
+          lldb_private::ConstString basename;
+          bool is_method = false;
+          ConstString mangled_name = mangled.GetMangledName();
+          if (SwiftLanguageRuntime::MethodName::
+                  ExtractFunctionBasenameFromMangled(mangled_name, basename,
+                                                     is_method)) {
+            if (basename && basename != mangled_name) {
+              if (is_method)
+                entries.method_to_index.Append(basename, value);
+              else
+                entries.basename_to_index.Append(basename, value);
+            }
+            continue;
+          }
+        }
+#endif // LLDB_ENABLE_SWIFT
+      }
+    }
+
+    // Symbol name strings that didn't match a Mangled::ManglingScheme, are
+    // stored in the demangled field.
+    SymbolContext sc;
+    symbol->CalculateSymbolContext(&sc);
+    sc.module_sp = m_objfile->GetModule();
+    if (ConstString name = mangled.GetDemangledName(&sc)) {
+      entries.name_to_index.Append(name, value);
+
+      if (symbol->ContainsLinkerAnnotations()) {
+        // If the symbol has linker annotations, also add the version without
+        // the annotations.
+        name = ConstString(
+            m_objfile->StripLinkerSymbolAnnotations(name.GetStringRef()));
+        entries.name_to_index.Append(name, value);
+      }
+
+      // If the demangled name turns out to be an ObjC name, and is a category
+      // name, add the version without categories to the index too.
+      for (Language *lang : languages) {
+        for (auto variant : lang->GetMethodNameVariants(name)) {
+          if (variant.GetType() & lldb::eFunctionNameTypeSelector)
+            entries.selector_to_index.Append(variant.GetName(), value);
+          else if (variant.GetType() & lldb::eFunctionNameTypeFull)
+            entries.name_to_index.Append(variant.GetName(), value);
+          else if (variant.GetType() & lldb::eFunctionNameTypeMethod)
+            entries.method_to_index.Append(variant.GetName(), value);
+          else if (variant.GetType() & lldb::eFunctionNameTypeBase)
+            entries.basename_to_index.Append(variant.GetName(), value);
+        }
+      }
+    }
+  }
+}
+
+void Symtab::RegisterMangledNameEntry(uint32_t value, NameIndexEntries &entries,
+                                      RichManglingContext &rmc) {
   // Only register functions that have a base name.
   llvm::StringRef base_name = rmc.ParseFunctionBaseName();
   if (base_name.empty())
@@ -429,41 +467,36 @@ void Symtab::RegisterMangledNameEntry(
   // Register functions with no context.
   if (decl_context.empty()) {
     // This has to be a basename
-    auto &basename_to_index =
-        GetNameToSymbolIndexMap(lldb::eFunctionNameTypeBase);
-    basename_to_index.Append(entry);
+    entries.basename_to_index.Append(entry);
     // If there is no context (no namespaces or class scopes that come before
     // the function name) then this also could be a fullname.
-    auto &name_to_index = GetNameToSymbolIndexMap(lldb::eFunctionNameTypeNone);
-    name_to_index.Append(entry);
+    entries.name_to_index.Append(entry);
     return;
   }
 
   // Make sure we have a pool-string pointer and see if we already know the
   // context name.
   const char *decl_context_ccstr = ConstString(decl_context).GetCString();
-  auto it = class_contexts.find(decl_context_ccstr);
+  auto it = entries.class_contexts.find(decl_context_ccstr);
 
-  auto &method_to_index =
-      GetNameToSymbolIndexMap(lldb::eFunctionNameTypeMethod);
   // Register constructors and destructors. They are methods and create
   // declaration contexts.
   if (rmc.IsCtorOrDtor()) {
-    method_to_index.Append(entry);
-    if (it == class_contexts.end())
-      class_contexts.insert(it, decl_context_ccstr);
+    entries.method_to_index.Append(entry);
+    if (it == entries.class_contexts.end())
+      entries.class_contexts.insert(it, decl_context_ccstr);
     return;
   }
 
   // Register regular methods with a known declaration context.
-  if (it != class_contexts.end()) {
-    method_to_index.Append(entry);
+  if (it != entries.class_contexts.end()) {
+    entries.method_to_index.Append(entry);
     return;
   }
 
   // Regular methods in unknown declaration contexts are put to the backlog. We
   // will revisit them once we processed all remaining symbols.
-  backlog.push_back(std::make_pair(entry, decl_context_ccstr));
+  entries.backlog.push_back(std::make_pair(entry, decl_context_ccstr));
 }
 
 void Symtab::RegisterBacklogEntry(
@@ -874,6 +874,181 @@ private:
   }
 };
 
+/// A DenseMap variant that draws its bucket arrays from an externally owned
+/// allocator instead of the system heap.
+///
+/// \p AllocatorTy must provide the AllocatorBase interface (Allocate and
+/// Deallocate taking a size and alignment); it is held by reference and must
+/// outlive the map. The intended use is a BumpPtrAllocator owned by a longer
+/// lived object (e.g. a pass manager) that backs many short-lived maps and is
+/// reset in bulk, so per-query maps stop paying for malloc/free on every
+/// grow/rehash cycle. Deallocation is forwarded to the allocator, which for a
+/// BumpPtrAllocator is a no-op; memory is reclaimed when the arena is reset.
+///
+/// Maps sharing one allocator may only be swapped with each other.
+template <typename KeyT, typename ValueT, typename AllocatorTy,
+          typename KeyInfoT = DenseMapInfo<KeyT>,
+          typename BucketT = llvm::detail::DenseMapPair<KeyT, ValueT>>
+class AllocatorDenseMap
+    : public DenseMapBase<
+          AllocatorDenseMap<KeyT, ValueT, AllocatorTy, KeyInfoT, BucketT>,
+          KeyT, ValueT, KeyInfoT, BucketT> {
+  friend class DenseMapBase<AllocatorDenseMap, KeyT, ValueT, KeyInfoT,
+                            BucketT>;
+
+  // Lift some types from the dependent base class into this class for
+  // simplicity of referring to them.
+  using BaseT = DenseMapBase<AllocatorDenseMap, KeyT, ValueT, KeyInfoT,
+                             BucketT>;
+
+  AllocatorTy &Allocator;
+  BucketT *Buckets;
+  unsigned NumEntries;
+  unsigned NumTombstones;
+  unsigned NumBuckets;
+
+public:
+  explicit AllocatorDenseMap(AllocatorTy &A, unsigned InitialReserve = 0)
+      : Allocator(A) {
+    init(InitialReserve);
+  }
+
+  AllocatorDenseMap(const AllocatorDenseMap &other)
+      : BaseT(), Allocator(other.Allocator) {
+    init(0);
+    copyFrom(other);
+  }
+
+  AllocatorDenseMap(AllocatorDenseMap &&other)
+      : BaseT(), Allocator(other.Allocator) {
+    init(0);
+    swap(other);
+  }
+
+  ~AllocatorDenseMap() {
+    this->destroyAll();
+    deallocateBuckets();
+  }
+
+  void swap(AllocatorDenseMap &RHS) {
+    assert(&Allocator == &RHS.Allocator &&
+           "cannot swap maps backed by different allocators");
+    this->incrementEpoch();
+    RHS.incrementEpoch();
+    std::swap(Buckets, RHS.Buckets);
+    std::swap(NumEntries, RHS.NumEntries);
+    std::swap(NumTombstones, RHS.NumTombstones);
+    std::swap(NumBuckets, RHS.NumBuckets);
+  }
+
+  AllocatorDenseMap &operator=(const AllocatorDenseMap &other) {
+    if (&other != this)
+      copyFrom(other);
+    return *this;
+  }
+
+  AllocatorDenseMap &operator=(AllocatorDenseMap &&other) {
+    assert(&Allocator == &other.Allocator &&
+           "cannot move-assign maps backed by different allocators");
+    this->destroyAll();
+    deallocateBuckets();
+    init(0);
+    swap(other);
+    return *this;
+  }
+
+  void copyFrom(const AllocatorDenseMap &other) {
+    this->destroyAll();
+    deallocateBuckets();
+    if (allocateBuckets(other.NumBuckets)) {
+      this->BaseT::copyFrom(other);
+    } else {
+      NumEntries = 0;
+      NumTombstones = 0;
+    }
+  }
+
+  void init(unsigned InitNumEntries) {
+    auto InitBuckets = BaseT::getMinBucketToReserveForEntries(InitNumEntries);
+    if (allocateBuckets(InitBuckets)) {
+      this->BaseT::initEmpty();
+    } else {
+      NumEntries = 0;
+      NumTombstones = 0;
+    }
+  }
+
+  void grow(unsigned AtLeast) {
+    unsigned OldNumBuckets = NumBuckets;
+    BucketT *OldBuckets = Buckets;
+
+    allocateBuckets(std::max<unsigned>(
+        64, static_cast<unsigned>(NextPowerOf2(AtLeast - 1))));
+    assert(Buckets);
+    if (!OldBuckets) {
+      this->BaseT::initEmpty();
+      return;
+    }
+
+    this->moveFromOldBuckets(OldBuckets, OldBuckets + OldNumBuckets);
+
+    // Return the old table to the allocator.
+    Allocator.Deallocate(OldBuckets, sizeof(BucketT) * OldNumBuckets,
+                         alignof(BucketT));
+  }
+
+  void shrink_and_clear() {
+    unsigned OldNumBuckets = NumBuckets;
+    unsigned OldNumEntries = NumEntries;
+    this->destroyAll();
+
+    // Reduce the number of buckets.
+    unsigned NewNumBuckets = 0;
+    if (OldNumEntries)
+      NewNumBuckets = std::max(64, 1 << (Log2_32_Ceil(OldNumEntries) + 1));
+    if (NewNumBuckets == NumBuckets) {
+      this->BaseT::initEmpty();
+      return;
+    }
+
+    deallocateBuckets();
+    init(NewNumBuckets);
+  }
+
+  /// Return the allocator backing this map's bucket storage.
+  AllocatorTy &getAllocator() const { return Allocator; }
+
+private:
+  unsigned getNumEntries() const { return NumEntries; }
+
+  void setNumEntries(unsigned Num) { NumEntries = Num; }
+
+  unsigned getNumTombstones() const { return NumTombstones; }
+
+  void setNumTombstones(unsigned Num) { NumTombstones = Num; }
+
+  BucketT *getBuckets() const { return Buckets; }
+
+  unsigned getNumBuckets() const { return NumBuckets; }
+
+  bool allocateBuckets(unsigned Num) {
+    NumBuckets = Num;
+    if (NumBuckets == 0) {
+      Buckets = nullptr;
+      return false;
+    }
+
+    Buckets = static_cast<BucketT *>(
+        Allocator.Allocate(sizeof(BucketT) * NumBuckets, alignof(BucketT)));
+    return true;
+  }
+
+  void deallocateBuckets() {
+    Allocator.Deallocate(Buckets, sizeof(BucketT) * NumBuckets,
+                         alignof(BucketT));
+  }
+};
+
 template <typename KeyT, typename ValueT, unsigned InlineBuckets = 4,
           typename KeyInfoT = DenseMapInfo<KeyT>,
           typename BucketT = llvm::detail::DenseMapPair<KeyT, ValueT>>
@@ -60,12 +60,20 @@ protected:
   /// specified bucket will be non-null.  Otherwise, it will be null.  In either
   /// case, the FullHashValue field of the bucket will be set to the hash value
   /// of the string.
-  unsigned LookupBucketFor(StringRef Key);
+  unsigned LookupBucketFor(StringRef Key) {
+    return LookupBucketFor(Key, hash(Key));
+  }
+
+  /// Overload that explicitly takes precomputed hash(Key).
+  unsigned LookupBucketFor(StringRef Key, uint64_t FullHashValue);
 
   /// FindKey - Look up the bucket that contains the specified key. If it exists
   /// in the map, return the bucket number of the key.  Otherwise return -1.
   /// This does not modify the map.
-  int FindKey(StringRef Key) const;
+  int FindKey(StringRef Key) const { return FindKey(Key, hash(Key)); }
+
+  /// Overload that explicitly takes precomputed hash(Key).
+  int FindKey(StringRef Key, uint64_t FullHashValue) const;
 
   /// RemoveKey - Remove the specified StringMapEntry from the table, but do not
   /// delete it.  This aborts if the value isn't in the table.
@@ -80,6 +88,14 @@ protected:
   void init(unsigned Size);
 
 public:
+  /// Returns the hash value that will be used for the given string. Allows
+  /// precomputing the value and passing it explicitly to some of the
+  /// functions. The implementation of this function is not guaranteed to be
+  /// stable between LLVM releases. Clients with many lookups of the same
+  /// string (or scanning batches of identifiers) can hash once up front and
+  /// reuse the value instead of rehashing per probe.
+  static uint64_t hash(StringRef Key);
+
   static constexpr uintptr_t TombstoneIntVal =
       static_cast<uintptr_t>(-1)
       << PointerLikeTypeTraits<StringMapEntryBase *>::NumLowBitsAvailable;
@@ -810,6 +810,14 @@ void IrreducibleGraph::addEdges(const BlockNode &Node,
 ///     Using the min and max frequencies as a guide, translate floating point
 ///     frequencies to an appropriate range in uint64_t.
 ///
+/// Note that the result is inherently whole-function: a single block's
+/// frequency is only defined relative to the mass fixpoint over the entire
+/// loop nest (stages 2-4), and the integer encoding in stage 5 is normalized
+/// against the function-wide min and max. Demand-driven evaluation of
+/// individual blocks is therefore not possible without running all stages;
+/// clients that query only a few blocks should instead defer construction
+/// until the first query (see \a LazyBlockFrequencyInfo).
+///
 /// It has some known flaws.
 ///
 ///   - The model of irreducible control flow is a rough approximation.
@@ -25,6 +25,16 @@
 /// across common large module graph shapes which tend to be very wide and have
 /// large regions of unrelated cliques.
 ///
+/// Note that while the reference graph identifies regions that are logically
+/// independent, actually evaluating sibling SCCs concurrently is not currently
+/// possible: transforms create and unique constants, types, and metadata
+/// through the shared LLVMContext, mutate use-lists of globals visible across
+/// SCC boundaries, and update shared analysis results, none of which are
+/// thread-safe today. Until those structures are made safe for concurrent
+/// mutation (or sharded per worker), the adaptors below must visit SCCs
+/// strictly sequentially, and the update API is free to assume there is no
+/// concurrent mutation of the graph.
+///
 /// To satisfy these goals, we use the LazyCallGraph which provides two graphs
 /// nested inside each other (and built lazily from the bottom-up): the call
 /// graph proper, and a reference graph. The reference graph is super set of
@@ -120,7 +120,19 @@ public:
 
 class CostPriority : public InlinePriority {
   using PriorityT = int;
-  DenseMap<const CallBase *, PriorityT> Priorities;
+
+  // The cached priority of a call site, together with a cheap fingerprint of
+  // the callee it was computed against. The inline cost of a call site only
+  // changes when inlining grows the callee (or devirtualization retargets the
+  // call), so the fingerprint lets updateAndCheckDecreased skip the full cost
+  // analysis for call sites whose callee has not been edited since the last
+  // evaluation.
+  struct CachedPriority {
+    PriorityT Priority;
+    const Function *Callee;
+    unsigned CalleeInstrCount;
+  };
+  DenseMap<const CallBase *, CachedPriority> Priorities;
   std::function<InlineCost(const CallBase *)> getInlineCost;
 
   PriorityT evaluate(const CallBase *CB) {
@@ -146,18 +158,25 @@ public:
     const auto I1 = Priorities.find(L);
     const auto I2 = Priorities.find(R);
     assert(I1 != Priorities.end() && I2 != Priorities.end());
-    return isMoreDesirable(I2->second, I1->second);
+    return isMoreDesirable(I2->second.Priority, I1->second.Priority);
   }
 
   // Update the priority associated with CB.
-  void update(const CallBase *CB) override { Priorities[CB] = evaluate(CB); };
+  void update(const CallBase *CB) override {
+    const Function *Callee = CB->getCalledFunction();
+    Priorities[CB] = {evaluate(CB), Callee, Callee->getInstructionCount()};
+  };
 
   bool updateAndCheckDecreased(const CallBase *CB) override {
     auto It = Priorities.find(CB);
-    const auto OldPriority = It->second;
-    It->second = evaluate(CB);
-    const auto NewPriority = It->second;
-    return isMoreDesirable(OldPriority, NewPriority);
+    const Function *Callee = CB->getCalledFunction();
+    const unsigned CalleeInstrCount = Callee->getInstructionCount();
+    if (It->second.Callee == Callee &&
+        It->second.CalleeInstrCount == CalleeInstrCount)
+      return false;
+    const auto OldPriority = It->second.Priority;
+    It->second = {evaluate(CB), Callee, CalleeInstrCount};
+    return isMoreDesirable(OldPriority, It->second.Priority);
   }
 };
 
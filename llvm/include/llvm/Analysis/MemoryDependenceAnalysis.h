@@ -426,6 +426,11 @@ public:
   /// critical edges.
   void invalidateCachedPredecessors();
 
+  /// Clears the cached predecessor information for the given block only,
+  /// e.g. when splitting a critical edge into it. Cheaper than invalidating
+  /// every block when the mutation is known to be local.
+  void invalidateCachedPredecessors(BasicBlock *BB);
+
   /// Returns the instruction on which a memory location depends.
   ///
   /// If isLoad is true, this routine ignores may-aliases with read-only
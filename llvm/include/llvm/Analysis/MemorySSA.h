@@ -789,9 +789,11 @@ public:
 
   /// By default, uses are *not* optimized during MemorySSA construction.
   /// Calling this method will attempt to optimize all MemoryUses, if this has
-  /// not happened yet for this MemorySSA instance. This should be done if you
-  /// plan to query the clobbering access for most uses, or if you walk the
-  /// def-use chain of uses.
+  /// not happened yet for this MemorySSA instance. Updates made through
+  /// MemorySSAUpdater mark the instance as needing re-optimization, in which
+  /// case calling this again re-optimizes only the uses whose optimized state
+  /// was invalidated. This should be done if you plan to query the clobbering
+  /// access for most uses, or if you walk the def-use chain of uses.
   void ensureOptimizedUses();
 
 protected:
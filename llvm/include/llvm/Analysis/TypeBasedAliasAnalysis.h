@@ -15,10 +15,12 @@
 #ifndef LLVM_ANALYSIS_TYPEBASEDALIASANALYSIS_H
 #define LLVM_ANALYSIS_TYPEBASEDALIASANALYSIS_H
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Analysis/AliasAnalysis.h"
 #include "llvm/IR/PassManager.h"
 #include "llvm/Pass.h"
 #include <memory>
+#include <utility>
 
 namespace llvm {
 
@@ -34,7 +36,8 @@ class TypeBasedAAResult : public AAResultBase<TypeBasedAAResult> {
 public:
   /// Handle invalidation events from the new pass manager.
   ///
-  /// By definition, this result is stateless and so remains valid.
+  /// The only state is a memoization of queries over access tags, which are
+  /// uniqued, immutable metadata; the result therefore remains valid.
   bool invalidate(Function &, const PreservedAnalyses &,
                   FunctionAnalysisManager::Invalidator &) {
     return false;
@@ -52,6 +55,13 @@ public:
                            AAQueryInfo &AAQI);
 
 private:
+  /// Memoized results of access-tag matches. Access tags are uniqued MDNodes
+  /// and live as long as the context, so pointer-keyed entries never go
+  /// stale. Matching is symmetric, so pairs are keyed with the lower pointer
+  /// first.
+  mutable DenseMap<std::pair<const MDNode *, const MDNode *>, bool>
+      MatchCache;
+
   bool Aliases(const MDNode *A, const MDNode *B) const;
 };
 
@@ -13,6 +13,7 @@
 #ifndef LLVM_BITCODE_BITCODEWRITER_H
 #define LLVM_BITCODE_BITCODEWRITER_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/IR/ModuleSummaryIndex.h"
 #include "llvm/MC/StringTableBuilder.h"
@@ -132,6 +133,15 @@ class raw_ostream;
                           bool GenerateHash = false,
                           ModuleHash *ModHash = nullptr);
 
+  /// Write the specified modules to the output stream \p Out as a single
+  /// bitcode container. All module blocks reference one shared string table
+  /// block, so symbol names common to several modules (as is typical for
+  /// ThinLTO module slices) are emitted once. Readers enumerate the modules
+  /// via llvm::getBitcodeFileContents.
+  void WriteMultipleModulesToFile(ArrayRef<const Module *> Mods,
+                                  raw_ostream &Out,
+                                  bool ShouldPreserveUseListOrder = false);
+
   /// Write the specified thin link bitcode file (i.e., the minimized bitcode
   /// file) to the given raw output stream, where it will be written in a new
   /// bitcode block. The thin link bitcode file is used for thin link, and it
@@ -226,69 +226,94 @@ public:
   }
 
   Expected<uint32_t> ReadVBR(const unsigned NumBits) {
-    Expected<unsigned> MaybeRead = Read(NumBits);
-    if (!MaybeRead)
-      return MaybeRead;
-    uint32_t Piece = MaybeRead.get();
-
     assert(NumBits <= 32 && NumBits >= 1 && "Invalid NumBits value");
-    const uint32_t MaskBitOrder = (NumBits - 1);
-    const uint32_t Mask = 1UL << MaskBitOrder;
-
-    if ((Piece & Mask) == 0)
-      return Piece;
+    static const unsigned BitsInWord = sizeof(word_t) * 8;
+    static const unsigned ShiftMask = sizeof(word_t) > 4 ? 0x3f : 0x1f;
+    const uint32_t Mask = 1UL << (NumBits - 1);
 
+    // Decode chunks straight out of CurWord while it holds whole chunks,
+    // avoiding the per-chunk refill and end-of-stream checks in Read().
     uint32_t Result = 0;
     unsigned NextBit = 0;
-    while (true) {
-      Result |= (Piece & (Mask - 1)) << NextBit;
+    while (BitsInCurWord >= NumBits) {
+      uint32_t Piece = CurWord & (~word_t(0) >> (BitsInWord - NumBits));
+      // Use a mask to avoid undefined behavior.
+      CurWord >>= (NumBits & ShiftMask);
+      BitsInCurWord -= NumBits;
 
+      Result |= (Piece & (Mask - 1)) << NextBit;
       if ((Piece & Mask) == 0)
         return Result;
 
-      NextBit += NumBits-1;
+      NextBit += NumBits - 1;
       if (NextBit >= 32)
         return createStringError(std::errc::illegal_byte_sequence,
                                  "Unterminated VBR");
+    }
 
-      MaybeRead = Read(NumBits);
+    // The VBR continues across a word boundary; let Read() handle refilling.
+    while (true) {
+      Expected<unsigned> MaybeRead = Read(NumBits);
       if (!MaybeRead)
         return MaybeRead;
-      Piece = MaybeRead.get();
+      uint32_t Piece = MaybeRead.get();
+
+      Result |= (Piece & (Mask - 1)) << NextBit;
+      if ((Piece & Mask) == 0)
+        return Result;
+
+      NextBit += NumBits - 1;
+      if (NextBit >= 32)
+        return createStringError(std::errc::illegal_byte_sequence,
+                                 "Unterminated VBR");
     }
   }
 
   // Read a VBR that may have a value up to 64-bits in size. The chunk size of
   // the VBR must still be <= 32 bits though.
   Expected<uint64_t> ReadVBR64(const unsigned NumBits) {
-    Expected<uint64_t> MaybeRead = Read(NumBits);
-    if (!MaybeRead)
-      return MaybeRead;
-    uint32_t Piece = MaybeRead.get();
     assert(NumBits <= 32 && NumBits >= 1 && "Invalid NumBits value");
-    const uint32_t MaskBitOrder = (NumBits - 1);
-    const uint32_t Mask = 1UL << MaskBitOrder;
-
-    if ((Piece & Mask) == 0)
-      return uint64_t(Piece);
+    static const unsigned BitsInWord = sizeof(word_t) * 8;
+    static const unsigned ShiftMask = sizeof(word_t) > 4 ? 0x3f : 0x1f;
+    const uint32_t Mask = 1UL << (NumBits - 1);
 
+    // Decode chunks straight out of CurWord for as long as it holds whole
+    // chunks. This keeps the common case - the entire VBR sitting in the
+    // word we already loaded - free of the refill and end-of-stream checks
+    // that Read() performs per chunk.
     uint64_t Result = 0;
     unsigned NextBit = 0;
-    while (true) {
-      Result |= uint64_t(Piece & (Mask - 1)) << NextBit;
+    while (BitsInCurWord >= NumBits) {
+      uint32_t Piece = CurWord & (~word_t(0) >> (BitsInWord - NumBits));
+      // Use a mask to avoid undefined behavior.
+      CurWord >>= (NumBits & ShiftMask);
+      BitsInCurWord -= NumBits;
 
+      Result |= uint64_t(Piece & (Mask - 1)) << NextBit;
       if ((Piece & Mask) == 0)
         return Result;
 
-      NextBit += NumBits-1;
+      NextBit += NumBits - 1;
       if (NextBit >= 64)
         return createStringError(std::errc::illegal_byte_sequence,
                                  "Unterminated VBR");
+    }
 
-      MaybeRead = Read(NumBits);
+    // The VBR continues across a word boundary; let Read() handle refilling.
+    while (true) {
+      Expected<uint64_t> MaybeRead = Read(NumBits);
       if (!MaybeRead)
         return MaybeRead;
-      Piece = MaybeRead.get();
+      uint32_t Piece = MaybeRead.get();
+
+      Result |= uint64_t(Piece & (Mask - 1)) << NextBit;
+      if ((Piece & Mask) == 0)
+        return Result;
+
+      NextBit += NumBits - 1;
+      if (NextBit >= 64)
+        return createStringError(std::errc::illegal_byte_sequence,
+                                 "Unterminated VBR");
     }
   }
 
@@ -374,6 +374,13 @@ private:
   sys::fs::UniqueID UniqueID;
 };
 
+/// Guards a directory for concurrent lookups. Once a directory is complete —
+/// the steady state for a scanning daemon, reached after its first full
+/// listing — readers take no locks and touch no shared state beyond one
+/// relaxed load of IsComplete. While the directory is still being discovered,
+/// readers only bump an atomic reader count; the mutex is reserved for
+/// writers performing first insertion (see Writer), which wait for the
+/// reader count to drain.
 class FileSystemCache::Directory::Reader {
   std::atomic<int> *NumReaders = nullptr;
 
@@ -0,0 +1,62 @@
+//===- OnDiskStringPool.h ---------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CAS_ONDISKSTRINGPOOL_H
+#define LLVM_CAS_ONDISKSTRINGPOOL_H
+
+#include "llvm/ADT/Optional.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/CAS/OnDiskHashMappedTrie.h"
+#include "llvm/Support/Error.h"
+
+#if LLVM_ENABLE_ONDISK_CAS
+
+namespace llvm {
+namespace cas {
+
+/// A persistent, memory-mapped string interning pool.
+///
+/// Strings saved here survive across process invocations: the pool lives in a
+/// directory of mapped files, so a warm build-farm node interning the same
+/// paths and symbol names in every compile/link stops re-hashing and re-copying
+/// them. Like the underlying \a OnDiskHashMappedTrie, the pool may be opened
+/// concurrently by multiple threads and processes.
+///
+/// Saved strings are null-terminated and the returned StringRefs point into
+/// the mapping; they stay valid for the lifetime of this object.
+class OnDiskStringPool {
+public:
+  /// Open (or create) the pool rooted at directory \p Path.
+  static Expected<OnDiskStringPool> create(const Twine &Path);
+
+  /// Intern \p S, returning the pool's stable, null-terminated copy. Saving
+  /// an already-interned string is a hash plus a lookup; no data is written.
+  Expected<StringRef> save(StringRef S);
+
+  /// Return the interned copy of \p S if there is one, without inserting.
+  Optional<StringRef> lookup(StringRef S) const;
+
+  OnDiskStringPool(OnDiskStringPool &&RHS) = default;
+  OnDiskStringPool &operator=(OnDiskStringPool &&RHS) = default;
+  ~OnDiskStringPool() = default;
+
+private:
+  OnDiskStringPool(OnDiskHashMappedTrie Index, OnDiskDataAllocator Data);
+
+  /// Maps a BLAKE3 hash of the string to a (offset, size) record in Data.
+  OnDiskHashMappedTrie Index;
+
+  /// Holds the string bytes, each entry null-terminated.
+  OnDiskDataAllocator Data;
+};
+
+} // namespace cas
+} // namespace llvm
+
+#endif // LLVM_ENABLE_ONDISK_CAS
+#endif // LLVM_CAS_ONDISKSTRINGPOOL_H
@@ -324,6 +324,16 @@ class VirtRegMap;
     ///
     /// Currently, the only only changes that are supported are simple removal
     /// and addition of uses.
+    ///
+    /// Together with handleMove, this is the complete in-place update API,
+    /// and it covers the window in which the analysis is actually alive: the
+    /// result is computed once ahead of the coalescer and kept valid through
+    /// scheduling and register allocation, whose passes all patch it via
+    /// these hooks. Passes outside that window (the pre-RA sinking and
+    /// branch-folding stages, for instance) run while no LiveIntervals
+    /// result exists, so teaching them to preserve the analysis would not
+    /// remove any recomputation; extending the API towards whole-CFG edits
+    /// like block merging has therefore never paid for its complexity.
     void repairIntervalsInRange(MachineBasicBlock *MBB,
                                 MachineBasicBlock::iterator Begin,
                                 MachineBasicBlock::iterator End,
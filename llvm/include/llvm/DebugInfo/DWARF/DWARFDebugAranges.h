@@ -23,6 +23,12 @@ class DWARFContext;
 class DWARFDebugAranges {
 public:
   void generate(DWARFContext *CTX);
+
+  /// Find the CU offset describing \p Address, or -1ULL if there is none.
+  ///
+  /// Lookup is const and lock-free: once generate() has run, concurrent
+  /// callers (e.g. parallel symbolization threads) may query freely without
+  /// external synchronization.
   uint64_t findAddress(uint64_t Address) const;
 
 private:
@@ -34,6 +40,7 @@ private:
   /// Call appendRange multiple times and then call construct.
   void appendRange(uint64_t CUOffset, uint64_t LowPC, uint64_t HighPC);
   void construct();
+  void constructShardIndex();
 
   struct Range {
     explicit Range(uint64_t LowPC, uint64_t HighPC, uint64_t CUOffset)
@@ -80,6 +87,17 @@ private:
   std::vector<RangeEndpoint> Endpoints;
   RangeColl Aranges;
   DenseSet<uint64_t> ParsedCUOffsets;
+
+  /// A sharded index over Aranges: the address space covered by the ranges is
+  /// split into equally sized shards, and ShardOffsets[S] holds the index of
+  /// the first range that can describe an address in shard S (with a sentinel
+  /// entry of Aranges.size() at the end). findAddress only binary searches
+  /// the slice for the queried address's shard instead of all of Aranges.
+  /// uint32_t indices are sufficient: ranges are 24 bytes each, so an
+  /// overflowing count would imply ~100 GiB of aranges.
+  std::vector<uint32_t> ShardOffsets;
+  uint64_t ShardBase = 0;
+  unsigned ShardShift = 0;
 };
 
 } // end namespace llvm
@@ -163,6 +163,13 @@ template <> struct DenseMapInfo<BasicBlockEdge> {
 /// the dominator tree is initially constructed may still exist in the tree,
 /// even if the tree is properly updated. Calling code should not rely on the
 /// preceding statements; this is stated only to assist human understanding.
+///
+/// The tree is always computed from the IR; there is deliberately no support
+/// for persisting it across serialization boundaries (e.g. into bitcode for
+/// ThinLTO backends). Soundly adopting a precomputed tree would require
+/// validating it against the deserialized CFG, which costs on the same order
+/// as the near-linear SemiNCA construction it would replace, and the tree is
+/// invalidated by the first CFG-mutating pass in any case.
 class DominatorTree : public DominatorTreeBase<BasicBlock, false> {
  public:
   using Base = DominatorTreeBase<BasicBlock, false>;
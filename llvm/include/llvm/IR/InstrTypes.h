@@ -1938,11 +1938,16 @@ public:
 
   /// Return the number of operand bundles associated with this User.
   unsigned getNumOperandBundles() const {
-    return std::distance(bundle_op_info_begin(), bundle_op_info_end());
+    if (!hasDescriptor())
+      return 0;
+    return getDescriptor().size() / sizeof(BundleOpInfo);
   }
 
   /// Return true if this User has any operand bundles.
-  bool hasOperandBundles() const { return getNumOperandBundles() != 0; }
+  ///
+  /// The co-allocated descriptor exists exactly to hold bundle operand
+  /// infos, so its presence bit doubles as a constant-time bundle test.
+  bool hasOperandBundles() const { return hasDescriptor(); }
 
   /// Return the index of the first bundle operand in the Use array.
   unsigned getBundleOperandsStartIndex() const {
@@ -148,6 +148,27 @@ public:
   /// especially in release mode.
   void setDiscardValueNames(bool Discard);
 
+  /// Return true if metadata nodes are arena-allocated. Off by default.
+  bool hasArenaAllocatedMetadata() const;
+
+  /// Enable or disable arena allocation of metadata nodes. When enabled,
+  /// non-temporary nodes are carved out of a context-owned slab and freed
+  /// wholesale when the context is destroyed, eliminating per-node free()
+  /// traffic at teardown. Intended for short-lived contexts; memory for
+  /// nodes destroyed earlier is not reclaimed until the context dies.
+  void setArenaAllocatedMetadata(bool Enable);
+
+  /// Return true if the uniquing tables for operand-free constants are
+  /// guarded by locks. Off by default.
+  bool hasConcurrentConstantUniquing() const;
+
+  /// Enable or disable lock-guarded uniquing of operand-free constants
+  /// (integers, floats, null/undef/poison values and constant data) in this
+  /// context. When enabled, multiple threads may create such constants
+  /// concurrently; creation of constants with operands and all other context
+  /// state remains single-threaded.
+  void setConcurrentConstantUniquing(bool Enable);
+
   /// Whether there is a string map for uniquing debug info
   /// identifiers across the context.  Off by default.
   bool isODRUniquingDebugTypes() const;
@@ -956,9 +956,10 @@ class MDNode : public Metadata {
   struct alignas(alignof(size_t)) Header {
     bool IsResizable : 1;
     bool IsLarge : 1;
+    bool IsArenaAllocated : 1;
     size_t SmallSize : 4;
     size_t SmallNumOps : 4;
-    size_t : sizeof(size_t) * CHAR_BIT - 10;
+    size_t : sizeof(size_t) * CHAR_BIT - 11;
 
     unsigned NumUnresolved = 0;
     using LargeStorageVector = SmallVector<MDOperand, 0>;
@@ -1059,9 +1060,15 @@ protected:
          ArrayRef<Metadata *> Ops1, ArrayRef<Metadata *> Ops2 = None);
   ~MDNode() = default;
 
-  void *operator new(size_t Size, size_t NumOps, StorageType Storage);
+  void *operator new(size_t Size, size_t NumOps, StorageType Storage,
+                     LLVMContext &Context);
   void operator delete(void *Mem);
 
+  /// Required by std, but never called.
+  void operator delete(void *, size_t, StorageType, LLVMContext &) {
+    llvm_unreachable("Constructor throws?");
+  }
+
   /// Required by std, but never called.
   void operator delete(void *, unsigned) {
     llvm_unreachable("Constructor throws?");
@@ -802,10 +802,14 @@ public:
   /// Print the module to an output stream with an optional
   /// AssemblyAnnotationWriter.  If \c ShouldPreserveUseListOrder, then include
   /// uselistorder directives so that use-lists can be recreated when reading
-  /// the assembly.
+  /// the assembly. If \c PrintThreads is greater than 1, function bodies are
+  /// printed concurrently on that many threads (slot numbering is computed up
+  /// front, so the output is identical to a single-threaded print); it is
+  /// ignored when an AnnotationWriter is given or when use-list order is
+  /// preserved.
   void print(raw_ostream &OS, AssemblyAnnotationWriter *AAW,
-             bool ShouldPreserveUseListOrder = false,
-             bool IsForDebug = false) const;
+             bool ShouldPreserveUseListOrder = false, bool IsForDebug = false,
+             unsigned PrintThreads = 1) const;
 
   /// Dump the module to stderr (for debugging).
   void dump() const;
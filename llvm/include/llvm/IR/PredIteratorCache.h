@@ -67,6 +67,14 @@ public:
     return makeArrayRef(GetPreds(BB), GetNumPreds(BB));
   }
 
+  /// invalidate - Drop the cached list for the given block, e.g. because its
+  /// predecessor set changed. Other blocks stay cached. The memory backing
+  /// the stale list is not recycled until clear() is called.
+  void invalidate(BasicBlock *BB) {
+    BlockToPredsMap.erase(BB);
+    BlockToPredCountMap.erase(BB);
+  }
+
   /// clear - Remove all information.
   void clear() {
     BlockToPredsMap.clear();
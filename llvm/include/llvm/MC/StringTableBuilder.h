@@ -37,6 +37,10 @@ public:
 private:
   DenseMap<CachedHashStringRef, size_t> StringIndexMap;
   size_t Size = 0;
+  /// Extent of the table covered by previous finalize calls. Strings at
+  /// offsets below this are already laid out and keep their offsets when the
+  /// table is reopened and finalized again.
+  size_t FinalizedSize = 0;
   Kind K;
   unsigned Alignment;
   bool Finalized = false;
@@ -62,6 +66,15 @@ public:
   /// returned by add will still be valid.
   void finalizeInOrder();
 
+  /// Reopen a finalized table so more strings can be added. Offsets already
+  /// handed out remain valid: the next finalize call lays out only the
+  /// strings added since the previous one, appending them to the existing
+  /// contents, and skips re-sorting strings the table already holds. This
+  /// lets one builder be reused across a stream of outputs that largely
+  /// share their strings, at the cost of each output carrying the union of
+  /// the tables so far.
+  void reopen();
+
   /// Get the offest of a string in the string table. Can only be used
   /// after the table is finalized.
   size_t getOffset(CachedHashStringRef S) const;
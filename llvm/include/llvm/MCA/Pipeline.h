@@ -47,6 +47,18 @@ class HWEventListener;
 /// Internally, the Pipeline collects statistical information in the form of
 /// histograms. For example, it tracks how the dispatch group size changes
 /// over time.
+///
+/// A simulation always runs from the first fetched instruction to the last
+/// retired one; there is no way to checkpoint the pipeline mid-run and
+/// replay from the first instruction that differs between two snippets. The
+/// simulated state is not confined to this class: it lives in the hardware
+/// units owned by the stages (scheduler queues, register file state, the
+/// load/store unit, resource managers) and in whatever statistics the
+/// registered HWEventListeners have accumulated from events already
+/// delivered, none of which can be copied or rolled back. Callers comparing
+/// many variants of a snippet should instead share one Context/InstrBuilder
+/// so that instruction decoding is paid once, and run a fresh Pipeline per
+/// variant; building the stages is cheap next to the simulation itself.
 class Pipeline {
   Pipeline(const Pipeline &P) = delete;
   Pipeline &operator=(const Pipeline &P) = delete;
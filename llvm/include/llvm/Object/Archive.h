@@ -13,6 +13,7 @@
 #ifndef LLVM_OBJECT_ARCHIVE_H
 #define LLVM_OBJECT_ARCHIVE_H
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/fallible_iterator.h"
 #include "llvm/ADT/iterator_range.h"
@@ -389,6 +390,13 @@ private:
   unsigned Format : 3;
   unsigned IsThin : 1;
   mutable std::vector<std::unique_ptr<MemoryBuffer>> ThinBuffers;
+
+  /// Index over the symbol table, built on the first findSym call so that
+  /// later lookups are hash lookups instead of rescans. Keys point into
+  /// SymbolTable and therefore share the archive's lifetime. Names with
+  /// several table entries keep the first one, as the scan did.
+  mutable DenseMap<StringRef, Symbol> SymbolMap;
+  mutable bool SymbolMapBuilt = false;
 };
 
 class BigArchive : public Archive {
@@ -851,6 +851,16 @@ uint64_t ELFObjectFile<ELFT>::getSectionSize(DataRefImpl Sec) const {
   return getSection(Sec)->sh_size;
 }
 
+// Returns a view of the section's bytes exactly as stored in the file; for
+// SHF_COMPRESSED sections that is the compressed payload. Decompression is
+// deliberately the consumer's job (object::Decompressor): an ObjectFile only
+// hands out views into the underlying mapped buffer, and owning decompressed
+// copies here would pin them for the lifetime of the object whether or not a
+// caller ever needs them. Multi-pass consumers keep their own copy -
+// DWARFContext, for instance, inflates each debug section once into storage
+// it retains. Range-limited decompression is not available either way: zlib
+// streams and zstd frames are not seekable without an auxiliary seek table,
+// which compressed debug sections do not carry.
 template <class ELFT>
 Expected<ArrayRef<uint8_t>>
 ELFObjectFile<ELFT>::getSectionContents(DataRefImpl Sec) const {
@@ -79,6 +79,20 @@ public:
   void registerCallbacks(PassInstrumentationCallbacks &PIC);
 };
 
+/// Records pass and analysis runs as sections in the time-trace profiler,
+/// keyed by pass name with the IR unit name as detail, so a trace shows which
+/// function (or SCC, or loop) a slow pass spent its time on. Does nothing
+/// when the profiler is not initialized.
+class TimeProfilingPassesHandler {
+public:
+  TimeProfilingPassesHandler() = default;
+  void registerCallbacks(PassInstrumentationCallbacks &PIC);
+
+private:
+  void runBeforePass(StringRef PassID, Any IR);
+  void runAfterPass();
+};
+
 struct PrintPassOptions {
   /// Print adaptors and pass managers.
   bool Verbose = false;
@@ -505,6 +519,7 @@ class StandardInstrumentations {
   PrintIRInstrumentation PrintIR;
   PrintPassInstrumentation PrintPass;
   TimePassesHandler TimePasses;
+  TimeProfilingPassesHandler TimeProfilingPasses;
   OptNoneInstrumentation OptNone;
   OptBisectInstrumentation OptBisect;
   PreservedCFGCheckerInstrumentation PreservedCFGChecker;
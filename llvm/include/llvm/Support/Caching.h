@@ -71,6 +71,21 @@ Expected<FileCache> localCache(
     Twine CacheNameRef, Twine TempFilePrefixRef, Twine CacheDirectoryPathRef,
     AddBufferFn AddBuffer = [](size_t Task, std::unique_ptr<MemoryBuffer> MB) {
     });
+
+/// Create a two-level file cache: a fast local directory backed by a larger
+/// upstream one, typically on shared storage so that artifacts built on one
+/// machine are visible to others. Lookups try the local directory first and
+/// fall back to the upstream one; an upstream hit back-fills the local
+/// directory so subsequent links are served without touching the upstream
+/// tier. Artifacts produced on a miss in both tiers are committed locally and
+/// then published upstream on a best-effort basis — publish failures (e.g. a
+/// read-only or full upstream) are silently ignored. Both tiers use the same
+/// entry naming scheme as localCache and can be pruned with pruneCache().
+Expected<FileCache> tieredCache(
+    Twine CacheNameRef, Twine TempFilePrefixRef, Twine CacheDirectoryPathRef,
+    Twine UpstreamCacheDirectoryPathRef,
+    AddBufferFn AddBuffer = [](size_t Task, std::unique_ptr<MemoryBuffer> MB) {
+    });
 } // namespace llvm
 
 #endif
@@ -1274,6 +1274,16 @@ public:
     priv ///< May modify via data, but changes are lost on destruction.
   };
 
+  /// Expected access pattern for the mapping, used by \a advise.
+  enum advice {
+    advice_normal,     ///< No special access pattern.
+    advice_sequential, ///< Pages will be read once, in order; aggressive
+                       ///< readahead pays off.
+    advice_random,     ///< Pages will be touched sparsely; readahead is
+                       ///< wasted work.
+    advice_willneed    ///< Pages will be needed soon; start reading them in.
+  };
+
 private:
   /// Platform-specific mapping state.
   size_t Size = 0;
@@ -1299,6 +1309,7 @@ private:
 
   void unmapImpl();
   void dontNeedImpl();
+  void adviseImpl(advice A);
 
   std::error_code init(sys::fs::file_t FD, uint64_t Offset, mapmode Mode);
 
@@ -1330,6 +1341,10 @@ public:
   }
   void dontNeed() { dontNeedImpl(); }
 
+  /// Tell the kernel how the mapping will be accessed. This is a hint: it
+  /// calls madvise on *NIX systems and is a no-op elsewhere.
+  void advise(advice A) { adviseImpl(A); }
+
   size_t size() const;
   char *data() const;
 
@@ -81,6 +81,22 @@ public:
   /// function should not be called on a writable buffer.
   virtual void dontNeedIfMmap() {}
 
+  /// Declares how a file-backed buffer will be read so the kernel's readahead
+  /// can be primed accordingly (madvise on *NIX systems when the buffer is
+  /// memory mapped). This is purely a performance hint; it never affects the
+  /// contents of the buffer.
+  enum class AccessPattern {
+    Normal,     ///< No known access pattern.
+    Sequential, ///< Read once, front to back, e.g. bitcode parsing.
+    Random      ///< Touched sparsely, e.g. lazy AST deserialization.
+  };
+
+  /// Declare the access pattern of an already-created buffer. Only has an
+  /// effect on MemoryBuffer_MMap buffers; for other kinds the contents are
+  /// already resident. Prefer passing \a AccessPattern to the factory
+  /// functions when the pattern is known up front.
+  virtual void adviseAccessPatternIfMmap(AccessPattern Access) {}
+
   /// Open the specified file as a MemoryBuffer, returning a new MemoryBuffer
   /// if successful, otherwise returning null.
   ///
@@ -90,9 +106,12 @@ public:
   /// \param IsVolatile Set to true to indicate that the contents of the file
   /// can change outside the user's control, e.g. when libclang tries to parse
   /// while the user is editing/updating the file or if the file is on an NFS.
+  ///
+  /// \param Access Hint describing how the buffer will be read.
   static ErrorOr<std::unique_ptr<MemoryBuffer>>
   getFile(const Twine &Filename, bool IsText = false,
-          bool RequiresNullTerminator = true, bool IsVolatile = false);
+          bool RequiresNullTerminator = true, bool IsVolatile = false,
+          AccessPattern Access = AccessPattern::Normal);
 
   /// Read all of the specified file into a MemoryBuffer as a stream
   /// (i.e. until EOF reached). This is useful for special files that
@@ -105,7 +124,8 @@ public:
   /// Since this is in the middle of a file, the buffer is not null terminated.
   static ErrorOr<std::unique_ptr<MemoryBuffer>>
   getOpenFileSlice(sys::fs::file_t FD, const Twine &Filename, uint64_t MapSize,
-                   int64_t Offset, bool IsVolatile = false);
+                   int64_t Offset, bool IsVolatile = false,
+                   AccessPattern Access = AccessPattern::Normal);
 
   /// Given an already-open file descriptor, read the file and return a
   /// MemoryBuffer.
@@ -115,7 +135,8 @@ public:
   /// while the user is editing/updating the file or if the file is on an NFS.
   static ErrorOr<std::unique_ptr<MemoryBuffer>>
   getOpenFile(sys::fs::file_t FD, const Twine &Filename, uint64_t FileSize,
-              bool RequiresNullTerminator = true, bool IsVolatile = false);
+              bool RequiresNullTerminator = true, bool IsVolatile = false,
+              AccessPattern Access = AccessPattern::Normal);
 
   /// Open the specified memory range as a MemoryBuffer. Note that InputData
   /// must be null terminated if RequiresNullTerminator is true.
@@ -143,7 +164,8 @@ public:
   /// Map a subrange of the specified file as a MemoryBuffer.
   static ErrorOr<std::unique_ptr<MemoryBuffer>>
   getFileSlice(const Twine &Filename, uint64_t MapSize, uint64_t Offset,
-               bool IsVolatile = false);
+               bool IsVolatile = false,
+               AccessPattern Access = AccessPattern::Normal);
 
   //===--------------------------------------------------------------------===//
   // Provided for performance analysis.
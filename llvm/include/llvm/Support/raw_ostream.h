@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -42,6 +43,7 @@ enum FileAccess : unsigned;
 enum OpenFlags : unsigned;
 enum CreationDisposition : unsigned;
 class FileLocker;
+class mapped_file_region;
 } // end namespace fs
 } // end namespace sys
 
@@ -616,6 +618,65 @@ public:
   static bool classof(const raw_ostream *OS);
 };
 
+/// A raw_pwrite_stream that writes through a memory-mapped view of the output
+/// file instead of a heap buffer plus write(2) calls. Bytes are copied once,
+/// directly into the page cache, which is a significant win for multi-gigabyte
+/// outputs. The file is grown in large chunks as the stream advances and
+/// trimmed to the number of bytes actually written when the stream is closed.
+///
+/// Random-access rewrites via pwrite() are cheap since they are plain stores
+/// into the mapping. If the underlying file cannot be memory mapped the
+/// constructor reports an error; callers should then fall back to
+/// raw_fd_ostream.
+class raw_mmap_ostream : public raw_pwrite_stream {
+  int FD = -1;
+  bool ShouldClose = false;
+  uint64_t Pos = 0;
+  uint64_t Capacity = 0;
+  std::error_code EC;
+  std::unique_ptr<sys::fs::mapped_file_region> Region;
+
+  /// See raw_ostream::write_impl.
+  void write_impl(const char *Ptr, size_t Size) override;
+
+  void pwrite_impl(const char *Ptr, size_t Size, uint64_t Offset) override;
+
+  /// Return the current position within the stream.
+  uint64_t current_pos() const override { return Pos; }
+
+  /// Grow the file and remap it so at least \p AtLeast bytes fit.
+  std::error_code grow(uint64_t AtLeast);
+
+  /// Set the flag indicating that an output error has been encountered.
+  void error_detected(std::error_code EC) { this->EC = EC; }
+
+public:
+  /// Open \p Filename for writing via a read-write mapping. \p SizeHint, when
+  /// non-zero, pre-sizes the mapping to avoid remaps for outputs of roughly
+  /// known size. On failure \p EC is set and the stream must be destroyed
+  /// without being written to.
+  raw_mmap_ostream(StringRef Filename, std::error_code &EC,
+                   uint64_t SizeHint = 0);
+
+  ~raw_mmap_ostream() override;
+
+  /// Unmap the file, truncate it to the bytes actually written, and close the
+  /// descriptor. Called implicitly by the destructor.
+  void close();
+
+  std::error_code error() const { return EC; }
+
+  /// Return whether an output error (a failed grow or truncation) has been
+  /// encountered. Bytes written after a failure are dropped.
+  bool has_error() const { return bool(EC); }
+
+  /// Set the flag read by has_error() to false. As with raw_fd_ostream, if
+  /// the error flag is still set when the destructor runs, it calls
+  /// report_fatal_error; check has_error() and clear_error() after handling
+  /// the error to avoid that.
+  void clear_error() { EC = std::error_code(); }
+};
+
 //===----------------------------------------------------------------------===//
 // Output Stream Adaptors
 //===----------------------------------------------------------------------===//
@@ -147,6 +147,14 @@ public:
   /// This class holds the mapping between values and value numbers.  It is used
   /// as an efficient mechanism to determine the expression-wise equivalence of
   /// two values.
+  ///
+  /// The table is deliberately pass-local rather than an analysis result: a
+  /// value's number is defined in terms of its operands' numbers, so any IR
+  /// change between passes invalidates numbers transitively, and nothing in
+  /// the pass manager reports instruction-granularity changes that would
+  /// allow incremental repair. It also is not interchangeable with
+  /// EarlyCSE's hashing, which keys on dominator-scoped instruction shape
+  /// rather than recursive value numbers.
   class ValueTable {
     DenseMap<Value *, uint32_t> valueNumbering;
     DenseMap<Expression, uint32_t> expressionNumbering;
@@ -30,6 +30,10 @@ struct SimplifyCFGOptions {
   bool SinkCommonInsts = false;
   bool SimplifyCondBranch = true;
   bool FoldTwoEntryPHINode = true;
+  /// Bound on the number of full simplification sweeps over the function; 0
+  /// means iterate until no sweep makes a change. Later pipeline occurrences
+  /// of the pass clean up anything a bounded run leaves behind.
+  unsigned MaxIterations = 0;
 
   AssumptionCache *AC = nullptr;
 
@@ -62,6 +66,10 @@ struct SimplifyCFGOptions {
     SinkCommonInsts = B;
     return *this;
   }
+  SimplifyCFGOptions &maxIterations(unsigned I) {
+    MaxIterations = I;
+    return *this;
+  }
   SimplifyCFGOptions &setAssumptionCache(AssumptionCache *Cache) {
     AC = Cache;
     return *this;
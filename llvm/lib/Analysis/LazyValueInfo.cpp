@@ -170,8 +170,13 @@ namespace {
     /// Cached information per basic block.
     DenseMap<PoisoningVH<BasicBlock>, std::unique_ptr<BlockCacheEntry>>
         BlockCache;
-    /// Set of value handles used to erase values from the cache on deletion.
-    DenseSet<LVIValueHandle, DenseMapInfo<Value *>> ValueHandles;
+    /// Value handles used to erase values from the cache on deletion, each
+    /// mapped to the blocks that may cache an entry for the value. This keeps
+    /// erasure proportional to the value's own entries instead of requiring a
+    /// scan of the whole block cache.
+    DenseMap<LVIValueHandle, SmallPtrSet<BasicBlock *, 4>,
+             DenseMapInfo<Value *>>
+        ValueHandles;
 
     const BlockCacheEntry *getBlockEntry(BasicBlock *BB) const {
       auto It = BlockCache.find_as(BB);
@@ -189,10 +194,11 @@ namespace {
       return It->second.get();
     }
 
-    void addValueHandle(Value *Val) {
+    void addValueHandle(Value *Val, BasicBlock *BB) {
       auto HandleIt = ValueHandles.find_as(Val);
       if (HandleIt == ValueHandles.end())
-        ValueHandles.insert({ Val, this });
+        HandleIt = ValueHandles.insert({ LVIValueHandle(Val, this), {} }).first;
+      HandleIt->second.insert(BB);
     }
 
   public:
@@ -207,7 +213,7 @@ namespace {
       else
         Entry->LatticeElements.insert({ Val, Result });
 
-      addValueHandle(Val);
+      addValueHandle(Val, BB);
     }
 
     Optional<ValueLatticeElement> getCachedValueInfo(Value *V,
@@ -233,7 +239,7 @@ namespace {
       if (!Entry->NonNullPointers) {
         Entry->NonNullPointers = InitFn(BB);
         for (Value *V : *Entry->NonNullPointers)
-          addValueHandle(V);
+          addValueHandle(V, BB);
       }
 
       return Entry->NonNullPointers->count(V);
@@ -260,16 +266,21 @@ namespace {
 }
 
 void LazyValueInfoCache::eraseValue(Value *V) {
-  for (auto &Pair : BlockCache) {
-    Pair.second->LatticeElements.erase(V);
-    Pair.second->OverDefined.erase(V);
-    if (Pair.second->NonNullPointers)
-      Pair.second->NonNullPointers->erase(V);
+  auto HandleIt = ValueHandles.find_as(V);
+  if (HandleIt == ValueHandles.end())
+    return;
+
+  for (BasicBlock *BB : HandleIt->second) {
+    auto It = BlockCache.find_as(BB);
+    if (It == BlockCache.end())
+      continue;
+    It->second->LatticeElements.erase(V);
+    It->second->OverDefined.erase(V);
+    if (It->second->NonNullPointers)
+      It->second->NonNullPointers->erase(V);
   }
 
-  auto HandleIt = ValueHandles.find_as(V);
-  if (HandleIt != ValueHandles.end())
-    ValueHandles.erase(HandleIt);
+  ValueHandles.erase(HandleIt);
 }
 
 void LVIValueHandle::deleted() {
@@ -279,7 +290,26 @@ void LVIValueHandle::deleted() {
 }
 
 void LazyValueInfoCache::eraseBlock(BasicBlock *BB) {
-  BlockCache.erase(BB);
+  auto It = BlockCache.find_as(BB);
+  if (It == BlockCache.end())
+    return;
+
+  // Drop the block from the per-value block sets so they never hold a
+  // pointer to a deleted block.
+  auto EraseBlockForValue = [&](Value *V) {
+    auto HandleIt = ValueHandles.find_as(V);
+    if (HandleIt != ValueHandles.end())
+      HandleIt->second.erase(BB);
+  };
+  for (const auto &Pair : It->second->LatticeElements)
+    EraseBlockForValue(Pair.first);
+  for (const auto &V : It->second->OverDefined)
+    EraseBlockForValue(V);
+  if (It->second->NonNullPointers)
+    for (const auto &V : *It->second->NonNullPointers)
+      EraseBlockForValue(V);
+
+  BlockCache.erase(It);
 }
 
 void LazyValueInfoCache::threadEdgeImpl(BasicBlock *OldSucc,
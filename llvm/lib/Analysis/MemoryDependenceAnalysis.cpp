@@ -1501,6 +1501,10 @@ void MemoryDependenceResults::invalidateCachedPredecessors() {
   PredCache.clear();
 }
 
+void MemoryDependenceResults::invalidateCachedPredecessors(BasicBlock *BB) {
+  PredCache.invalidate(BB);
+}
+
 void MemoryDependenceResults::removeInstruction(Instruction *RemInst) {
   // Walk through the Non-local dependencies, removing this one as the value
   // for any cached queries.
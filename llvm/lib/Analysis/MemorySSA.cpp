@@ -1064,8 +1064,11 @@ public:
   }
 
   void invalidateInfo(MemoryAccess *MA) override {
-    if (auto *MUD = dyn_cast<MemoryUseOrDef>(MA))
+    if (auto *MUD = dyn_cast<MemoryUseOrDef>(MA)) {
       MUD->resetOptimized();
+      if (isa<MemoryUse>(MUD))
+        MSSA->IsOptimized = false;
+    }
   }
 };
 
@@ -1100,8 +1103,11 @@ public:
   }
 
   void invalidateInfo(MemoryAccess *MA) override {
-    if (auto *MUD = dyn_cast<MemoryUseOrDef>(MA))
+    if (auto *MUD = dyn_cast<MemoryUseOrDef>(MA)) {
       MUD->resetOptimized();
+      if (isa<MemoryUse>(MUD))
+        MSSA->IsOptimized = false;
+    }
   }
 };
 
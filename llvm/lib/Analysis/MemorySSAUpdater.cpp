@@ -236,6 +236,9 @@ MemoryAccess *MemorySSAUpdater::tryRemoveTrivialPhi(MemoryPhi *Phi,
 }
 
 void MemorySSAUpdater::insertUse(MemoryUse *MU, bool RenameUses) {
+  // The new use starts unoptimized; let the next ensureOptimizedUses() pick
+  // it up in batch.
+  MSSA->IsOptimized = false;
   VisitedBlocks.clear();
   InsertedPHIs.clear();
   MU->setDefiningAccess(getPreviousDef(MU));
@@ -305,6 +308,9 @@ static void setMemoryPhiValueForBlock(MemoryPhi *MP, const BasicBlock *BB,
 // point to the correct new defs, to ensure we only have one variable, and no
 // disconnected stores.
 void MemorySSAUpdater::insertDef(MemoryDef *MD, bool RenameUses) {
+  // Uses optimized past the new def become unoptimized when they are
+  // renamed to it; allow ensureOptimizedUses() to re-optimize them.
+  MSSA->IsOptimized = false;
   // Don't bother updating dead code.
   if (!MSSA->DT->isReachableFromEntry(MD->getBlock())) {
     MD->setDefiningAccess(MSSA->getLiveOnEntryDef());
@@ -866,6 +872,8 @@ void MemorySSAUpdater::applyInsertUpdates(ArrayRef<CFGUpdate> Updates,
 void MemorySSAUpdater::applyInsertUpdates(ArrayRef<CFGUpdate> Updates,
                                           DominatorTree &DT,
                                           const GraphDiff<BasicBlock *> *GD) {
+  // Accesses rewired to new defs or phis below lose their optimized state.
+  MSSA->IsOptimized = false;
   // Get recursive last Def, assuming well formed MSSA and updated DT.
   auto GetLastDef = [&](BasicBlock *BB) -> MemoryAccess * {
     while (true) {
@@ -1305,6 +1313,8 @@ void MemorySSAUpdater::wireOldPredecessorsToNewImmediatePredecessor(
 void MemorySSAUpdater::removeMemoryAccess(MemoryAccess *MA, bool OptimizePhis) {
   assert(!MSSA->isLiveOnEntryDef(MA) &&
          "Trying to remove the live on entry def");
+  // Users of MA have their optimized state reset below.
+  MSSA->IsOptimized = false;
   // We can only delete phi nodes if they have no uses, or we can replace all
   // uses with a single definition.
   MemoryAccess *NewDefTarget = nullptr;
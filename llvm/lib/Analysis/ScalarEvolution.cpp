@@ -8338,9 +8338,12 @@ void ScalarEvolution::forgetLoop(const Loop *L) {
         ToForget.push_back(It->second);
         if (PHINode *PN = dyn_cast<PHINode>(I))
           ConstantEvolutionLoopExitValue.erase(PN);
-      }
 
-      PushDefUseChildren(I, Worklist, Visited);
+        // Only instructions with cached SCEVs can have users whose cached
+        // SCEVs reference the loop: computing a user's SCEV would have
+        // computed and cached the operand's SCEV first.
+        PushDefUseChildren(I, Worklist, Visited);
+      }
     }
 
     LoopPropertiesCache.erase(CurrL);
@@ -8375,9 +8378,13 @@ void ScalarEvolution::forgetValue(Value *V) {
       ToForget.push_back(It->second);
       if (PHINode *PN = dyn_cast<PHINode>(I))
         ConstantEvolutionLoopExitValue.erase(PN);
-    }
 
-    PushDefUseChildren(I, Worklist, Visited);
+      // An instruction without a cached SCEV cannot appear in any of its
+      // users' cached SCEVs either, so the walk can stop here; dropping the
+      // expressions found so far is handled by the SCEVUsers reverse edges
+      // in forgetMemoizedResults.
+      PushDefUseChildren(I, Worklist, Visited);
+    }
   }
   forgetMemoizedResults(ToForget);
 }
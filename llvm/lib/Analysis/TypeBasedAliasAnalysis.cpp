@@ -706,7 +706,21 @@ static bool matchAccessTags(const MDNode *A, const MDNode *B,
 /// Aliases - Test whether the access represented by tag A may alias the
 /// access represented by tag B.
 bool TypeBasedAAResult::Aliases(const MDNode *A, const MDNode *B) const {
-  return matchAccessTags(A, B);
+  // Trivial cases are cheaper to answer directly than to memoize.
+  if (A == B || !A || !B)
+    return true;
+
+  std::pair<const MDNode *, const MDNode *> Key(A, B);
+  if (Key.first > Key.second)
+    std::swap(Key.first, Key.second);
+
+  auto It = MatchCache.find(Key);
+  if (It != MatchCache.end())
+    return It->second;
+
+  bool Result = matchAccessTags(A, B);
+  MatchCache.try_emplace(Key, Result);
+  return Result;
 }
 
 AnalysisKey TypeBasedAA::Key;
@@ -121,10 +121,28 @@ struct Query {
   /// If true, it is safe to use metadata during simplification.
   InstrInfoQuery IIQ;
 
+  /// Per-query memoization of computeKnownBits results. Within one query the
+  /// context instruction and assumption set are fixed, so a result computed
+  /// for a value is valid on every later visit of the same value. The
+  /// recursion explores a use-def DAG, so without memoization diamond-shaped
+  /// def graphs are re-walked once per path. Each entry records the depth at
+  /// which it was computed; an entry computed close to the recursion cutoff
+  /// is not reused where a larger remaining budget could give a more precise
+  /// answer.
+  mutable SmallDenseMap<const Value *, std::pair<KnownBits, unsigned>, 8>
+      KnownBitsCache;
+
   Query(const DataLayout &DL, AssumptionCache *AC, const Instruction *CxtI,
         const DominatorTree *DT, bool UseInstrInfo,
         OptimizationRemarkEmitter *ORE = nullptr)
       : DL(DL), AC(AC), CxtI(CxtI), DT(DT), ORE(ORE), IIQ(UseInstrInfo) {}
+
+  /// Copies exist to re-ask with a different context instruction (e.g. per
+  /// incoming edge of a phi). Known-bits results are specific to the context
+  /// instruction, so the memoization cache is deliberately not inherited.
+  Query(const Query &Other)
+      : DL(Other.DL), AC(Other.AC), CxtI(Other.CxtI), DT(Other.DT),
+        ORE(Other.ORE), IIQ(Other.IIQ) {}
 };
 
 } // end anonymous namespace
@@ -2046,6 +2064,17 @@ void computeKnownBits(const Value *V, const APInt &DemandedElts,
   if (Depth == MaxAnalysisRecursionDepth)
     return;
 
+  // The cache is only keyed on the value, so it can only serve queries that
+  // demand all elements.
+  bool CacheableQuery = DemandedElts.isAllOnes();
+  if (CacheableQuery) {
+    auto It = Q.KnownBitsCache.find(V);
+    if (It != Q.KnownBitsCache.end() && It->second.second <= Depth) {
+      Known = It->second.first;
+      return;
+    }
+  }
+
   // A weak GlobalAlias is totally unknown. A non-weak GlobalAlias has
   // the bits of its aliasee.
   if (const GlobalAlias *GA = dyn_cast<GlobalAlias>(V)) {
@@ -2069,6 +2098,11 @@ void computeKnownBits(const Value *V, const APInt &DemandedElts,
   // Check whether a nearby assume intrinsic can determine some known bits.
   computeKnownBitsFromAssume(V, Known, Depth, Q);
 
+  // Reaching this point means any existing cache entry was computed with less
+  // remaining depth budget, so this result is at least as precise.
+  if (CacheableQuery)
+    Q.KnownBitsCache[V] = {Known, Depth};
+
   assert((Known.Zero & Known.One) == 0 && "Bits known to be one AND zero?");
 }
 
@@ -37,8 +37,12 @@ class MetadataLoader {
 
 public:
   ~MetadataLoader();
+  /// If \p LazyLoadOnDemand is true, module-level metadata is indexed and
+  /// loaded on demand (as it always is when \p IsImporting), rather than
+  /// materialized in full the first time the metadata block is parsed.
   MetadataLoader(BitstreamCursor &Stream, Module &TheModule,
                  BitcodeReaderValueList &ValueList, bool IsImporting,
+                 bool LazyLoadOnDemand,
                  std::function<Type *(unsigned)> getTypeByID);
   MetadataLoader &operator=(MetadataLoader &&);
   MetadataLoader(MetadataLoader &&);
@@ -4717,6 +4717,25 @@ void llvm::WriteBitcodeToFile(const Module &M, raw_ostream &Out,
     Out.write((char *)&Buffer.front(), Buffer.size());
 }
 
+/// Write the specified modules to the specified output stream as one
+/// container sharing a single string table.
+void llvm::WriteMultipleModulesToFile(ArrayRef<const Module *> Mods,
+                                      raw_ostream &Out,
+                                      bool ShouldPreserveUseListOrder) {
+  SmallVector<char, 0> Buffer;
+  Buffer.reserve(256 * 1024);
+
+  BitcodeWriter Writer(Buffer, dyn_cast<raw_fd_stream>(&Out));
+  for (const Module *M : Mods)
+    Writer.writeModule(*M, ShouldPreserveUseListOrder);
+  Writer.writeSymtab();
+  Writer.writeStrtab();
+
+  // Write the generated bitstream to "Out".
+  if (!Buffer.empty())
+    Out.write((char *)&Buffer.front(), Buffer.size());
+}
+
 void IndexBitcodeWriter::write() {
   Stream.EnterSubblock(bitc::MODULE_BLOCK_ID, 3);
 
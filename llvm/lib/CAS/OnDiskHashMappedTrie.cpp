@@ -27,6 +27,16 @@ static_assert(sizeof(size_t) == sizeof(uint64_t), "64-bit only");
 static_assert(sizeof(std::atomic<int64_t>) == sizeof(uint64_t),
               "Requires lock-free 64-bit atomics");
 
+// A note on ingestion throughput: records are inserted with plain stores and
+// atomic compare-exchanges into a lazily-grown file mapping. There are no
+// write() calls to batch and no per-insert fsync — dirty pages reach disk via
+// kernel writeback — so an async submission queue (io_uring or otherwise)
+// would add a layer without removing any syscalls. The costs that remain are
+// minor page faults on first touch of mapped pages and cache misses walking
+// subtries, and inserts from multiple threads are already safe, so bulk
+// imports scale by sharding the input across threads rather than through a
+// batching API here.
+
 //===----------------------------------------------------------------------===//
 // Generic database data structures.
 //===----------------------------------------------------------------------===//
@@ -0,0 +1,116 @@
+//===- OnDiskStringPool.cpp -----------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/CAS/OnDiskStringPool.h"
+
+#if LLVM_ENABLE_ONDISK_CAS
+
+#include "llvm/Support/BLAKE3.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+
+using namespace llvm;
+using namespace llvm::cas;
+
+/// The pool keys strings by a truncated BLAKE3 hash, wide enough to treat
+/// matches as identity without re-comparing string bytes across processes.
+static constexpr size_t NumHashBytes = 20;
+using PoolHashType = std::array<uint8_t, NumHashBytes>;
+
+namespace {
+/// Fixed-size trie record pointing at the string bytes in the data pool. The
+/// layout is in-memory only in the same sense as the rest of the on-disk trie:
+/// not portable between hosts, but stable for local reuse.
+struct StringRecord {
+  uint64_t Offset;
+  uint64_t Size;
+};
+} // namespace
+
+static PoolHashType hashString(StringRef S) {
+  return BLAKE3::hash<NumHashBytes>(
+      ArrayRef(reinterpret_cast<const uint8_t *>(S.data()), S.size()));
+}
+
+static constexpr StringLiteral IndexFile = "v1.index";
+static constexpr StringLiteral DataFile = "v1.data";
+
+Expected<OnDiskStringPool> OnDiskStringPool::create(const Twine &PathTwine) {
+  SmallString<128> Path;
+  PathTwine.toVector(Path);
+  if (std::error_code EC = sys::fs::create_directories(Path))
+    return createFileError(Path, EC);
+
+  const StringRef Slash = sys::path::get_separator();
+  constexpr uint64_t MB = 1024ull * 1024ull;
+  constexpr uint64_t GB = 1024ull * 1024ull * 1024ull;
+
+  Optional<OnDiskHashMappedTrie> Index;
+  if (Error E = OnDiskHashMappedTrie::create(
+                    Path + Slash + IndexFile, "llvm.stringpool.index[blake3]",
+                    NumHashBytes * 8, /*DataSize=*/sizeof(StringRecord),
+                    /*MaxFileSize=*/GB, /*NewFileInitialSize=*/MB)
+                    .moveInto(Index))
+    return std::move(E);
+
+  Optional<OnDiskDataAllocator> Data;
+  if (Error E = OnDiskDataAllocator::create(
+                    Path + Slash + DataFile, "llvm.stringpool.data",
+                    /*MaxFileSize=*/8 * GB, /*NewFileInitialSize=*/MB)
+                    .moveInto(Data))
+    return std::move(E);
+
+  return OnDiskStringPool(std::move(*Index), std::move(*Data));
+}
+
+OnDiskStringPool::OnDiskStringPool(OnDiskHashMappedTrie Index,
+                                   OnDiskDataAllocator Data)
+    : Index(std::move(Index)), Data(std::move(Data)) {}
+
+static StringRef getString(const OnDiskDataAllocator &Data,
+                           ArrayRef<char> RecordData) {
+  assert(RecordData.size() == sizeof(StringRecord));
+  StringRecord R;
+  memcpy(&R, RecordData.data(), sizeof(R));
+  return StringRef(
+      const_cast<OnDiskDataAllocator &>(Data).beginData(FileOffset(R.Offset)),
+      R.Size);
+}
+
+Expected<StringRef> OnDiskStringPool::save(StringRef S) {
+  PoolHashType Hash = hashString(S);
+  OnDiskHashMappedTrie::pointer P = Index.insertLazy(
+      ArrayRef(Hash.data(), Hash.size()),
+      [&](FileOffset, OnDiskHashMappedTrie::ValueProxy TentativeValue) {
+        // Copy the bytes (plus a null terminator) into the data pool, then
+        // point the trie record at them. If we lose an insertion race the
+        // bytes leak into the pool, which the bump-pointer data store cannot
+        // reclaim anyway; the winner's record is used by everyone.
+        OnDiskDataAllocator::pointer Bytes = Data.allocate(S.size() + 1);
+        memcpy(Bytes->data(), S.data(), S.size());
+        (*Bytes)[S.size()] = 0;
+        StringRecord R{(uint64_t)Bytes.getOffset().get(), (uint64_t)S.size()};
+        assert(TentativeValue.Data.size() == sizeof(R));
+        memcpy(TentativeValue.Data.data(), &R, sizeof(R));
+      });
+  if (!P)
+    return createStringError(std::make_error_code(std::errc::io_error),
+                             "string pool: failed to insert string");
+  return getString(Data, P->Data);
+}
+
+Optional<StringRef> OnDiskStringPool::lookup(StringRef S) const {
+  PoolHashType Hash = hashString(S);
+  OnDiskHashMappedTrie::const_pointer P =
+      Index.find(ArrayRef(Hash.data(), Hash.size()));
+  if (!P)
+    return None;
+  return getString(Data, P->Data);
+}
+
+#endif // LLVM_ENABLE_ONDISK_CAS
@@ -50,6 +50,15 @@ void AccelTableBase::computeBucketCount() {
     BucketCount = std::max<uint32_t>(UniqueHashCount, 1);
 }
 
+// Note on parallelizing this: there is little serial hashing left to win
+// back. Each unique name is hashed once, at addName() time, interleaved with
+// DIE construction; what remains here is bucketing and sorting, and it runs
+// under the AsmPrinter whose MCContext (see the createTempSymbol calls
+// below) is not thread-safe. On the consumer side the emitted .debug_names
+// layout is already the memory-mapped, constant-time structure the DWARF v5
+// spec defines -- readers hash the key and index the mapped bucket array
+// directly -- so faster debugger attach comes from emitting complete
+// indexes, not from a different lookup layout.
 void AccelTableBase::finalize(AsmPrinter *Asm, StringRef Prefix) {
   // Create the individual hash data outputs.
   for (auto &E : Entries) {
@@ -9,6 +9,16 @@
 // This file implements the class that parses the optional LLVM IR and machine
 // functions that are stored in MIR files.
 //
+// MIR deliberately stays a YAML text format with one document per machine
+// function. A binary encoding with a per-function offset index has been
+// proposed more than once for faster reproducer loading, but MIR's reason
+// for existing is that humans read, diff and hand-edit the snapshots, and
+// every MIR file in circulation - including every target's test suite - is
+// text that a second format would have to keep round-tripping with. Large
+// corpora are better served by splitting them into one function per file at
+// generation time than by teaching every MIR consumer two formats; the
+// document-per-function structure below makes such splitting trivial.
+//
 //===----------------------------------------------------------------------===//
 
 #include "llvm/CodeGen/MIRParser/MIRParser.h"
@@ -402,6 +402,10 @@ class MachineBlockPlacement : public MachineFunctionPass {
   /// False: use block frequency to compute tail duplication cost.
   bool UseProfileCount;
 
+  /// Whether tail duplication is explored during this run. Combines the
+  /// command-line control with the optimization level of the pipeline.
+  bool TailDupEnabled = false;
+
   /// Allocator and owner of BlockChain structures.
   ///
   /// We build BlockChains lazily while processing the loop structure of
@@ -588,7 +592,7 @@ public:
 
   bool allowTailDupPlacement() const {
     assert(F);
-    return TailDupPlacement && !F->getTarget().requiresStructuredCFG();
+    return TailDupEnabled && !F->getTarget().requiresStructuredCFG();
   }
 
   void getAnalysisUsage(AnalysisUsage &AU) const override {
@@ -3363,6 +3367,15 @@ bool MachineBlockPlacement::runOnMachineFunction(MachineFunction &MF) {
     TailDupSize = TailDupPlacementAggressiveThreshold;
 
   TargetPassConfig *PassConfig = &getAnalysis<TargetPassConfig>();
+  // Exploring tail duplication candidates makes chain construction
+  // substantially more expensive and mostly pays off in hot outline
+  // branches. For latency-sensitive tiers compiling at -O1, fall back to
+  // plain frequency-greedy chain layout unless tail duplication was
+  // requested explicitly.
+  TailDupEnabled = TailDupPlacement &&
+                   (PassConfig->getOptLevel() >= CodeGenOpt::Default ||
+                    TailDupPlacement.getNumOccurrences() != 0);
+
   // For aggressive optimization, we can adjust some thresholds to be less
   // conservative.
   if (PassConfig->getOptLevel() >= CodeGenOpt::Aggressive) {
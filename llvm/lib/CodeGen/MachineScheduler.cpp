@@ -1272,6 +1272,17 @@ void ScheduleDAGMILive::schedule() {
 }
 
 /// Build the DAG and setup three register pressure trackers.
+///
+/// The dependence graph is built exactly once per scheduling region per
+/// scheduler instance: bidirectional strategies walk the same DAG from both
+/// ends rather than rebuilding it per direction. It cannot be carried over
+/// from the pre-RA scheduler to the post-RA one, however tempting a
+/// content-keyed cache sounds. Register allocation rewrites the region in
+/// between - virtual registers become physical ones with entirely different
+/// anti- and output-dependences, and spill and copy insertion changes the
+/// instruction sequence - so the earlier edges describe code that no longer
+/// exists, and the SUnits pin MachineInstr pointers that may have been
+/// deleted.
 void ScheduleDAGMILive::buildDAGWithRegPressure() {
   if (!ShouldTrackPressure) {
     RPTracker.reset();
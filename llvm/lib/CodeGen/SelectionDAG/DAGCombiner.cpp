@@ -179,6 +179,16 @@ namespace {
     ///
     /// This is used to allow us to reliably add any operands of a DAG node
     /// which have not yet been combined to the worklist.
+    ///
+    /// Note that this set is as much caching of failed combine attempts as
+    /// the combiner can safely do. It is tempting to also remember *which*
+    /// combines failed on a node and skip them until the node changes, but
+    /// a node is only pulled off the worklist again after something around
+    /// it was edited, and many combines key on the surroundings rather than
+    /// the node itself: hasOneUse checks and repeated-divisor counting react
+    /// to use-count changes, for which no update callback exists. A failure
+    /// memo without a reliable invalidation signal quietly drops combines,
+    /// which shows up as codegen regressions rather than compile-time wins.
     SmallPtrSet<SDNode *, 32> CombinedNodes;
 
     /// Map from candidate StoreNode to the pair of RootNode and count.
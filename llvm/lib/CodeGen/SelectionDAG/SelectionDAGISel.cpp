@@ -1329,6 +1329,15 @@ static void processDbgDeclares(FunctionLoweringInfo &FuncInfo) {
   }
 }
 
+// Blocks are visited strictly serially, and that is load-bearing rather than
+// an implementation accident: selecting a block assigns virtual register
+// numbers in the shared MachineRegisterInfo, records vreg mappings for
+// cross-block values in the shared FunctionLoweringInfo, and exports values
+// demanded by successor blocks as it goes, so a block's lowering depends on
+// every predecessor already having been selected. Per-thread SelectionDAG
+// allocators would not make the blocks independent, and the LLVMContext
+// consulted for types and constants during DAG construction is not
+// thread-safe in any case.
 void SelectionDAGISel::SelectAllBasicBlocks(const Function &Fn) {
   FastISelFailed = false;
   // Initialize the Fast-ISel state, if needed.
@@ -2789,6 +2798,17 @@ public:
 
 } // end anonymous namespace
 
+// The matcher table is a byte-granular, VBR-compressed encoding interpreted
+// by the switch below, and both choices are deliberate trade-offs against
+// table size. Word-aligning operands would simplify decode but roughly
+// double multi-megabyte tables like X86's, and since most of a table is
+// cold, the cache miss cost of the fatter encoding outweighs the shift-and
+// -or it saves; the hot prefix (the OPC_SwitchOpcode jump table at each
+// root) is compact precisely because of the byte encoding. Dispatch stays
+// a switch rather than computed goto because the interpreter must build
+// with compilers that lack the extension, and the failure-scope stack is
+// the matcher's backtracking semantics, not bookkeeping that can be
+// hoisted out of the loop.
 void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
                                         const unsigned char *MatcherTable,
                                         unsigned TableSize) {
@@ -48,6 +48,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/PostOrderIterator.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallVector.h"
@@ -107,6 +108,13 @@ namespace {
 /// does not rely on expensive data-flow analysis. Instead we use the
 /// dominance properties and loop information to decide which point
 /// are safe for such insertion.
+///
+/// Only a single save point and a single restore point are computed.
+/// Splitting the frame setup across several regions (or per register, as
+/// GCC's -fshrink-wrap-separate does) would require MachineFrameInfo,
+/// PrologEpilogInserter and every target's frame lowering to describe more
+/// than one prologue, so when no single point beats the entry/exit
+/// placement we leave the frame where it is.
 class ShrinkWrap : public MachineFunctionPass {
   /// Hold callee-saved information.
   RegisterClassInfo RCI;
@@ -157,10 +165,26 @@ class ShrinkWrap : public MachineFunctionPass {
   /// Current MachineFunction.
   MachineFunction *MachineFunc;
 
+  /// Cache the result of useOrDefCSROrFI for each instruction we have
+  /// already classified. The pass never modifies the function, so an
+  /// answer stays valid for the whole analysis, and the candidate
+  /// refinement loop keeps revisiting the same terminators.
+  mutable DenseMap<const MachineInstr *, bool> UseOrDefCSRCache;
+
   /// Check if \p MI uses or defines a callee-saved register or
   /// a frame index. If this is the case, this means \p MI must happen
   /// after Save and before Restore.
-  bool useOrDefCSROrFI(const MachineInstr &MI, RegScavenger *RS) const;
+  bool useOrDefCSROrFI(const MachineInstr &MI, RegScavenger *RS) const {
+    auto It = UseOrDefCSRCache.find(&MI);
+    if (It != UseOrDefCSRCache.end())
+      return It->second;
+    bool Result = computeUseOrDefCSROrFI(MI, RS);
+    UseOrDefCSRCache[&MI] = Result;
+    return Result;
+  }
+
+  /// Compute the answer cached by useOrDefCSROrFI.
+  bool computeUseOrDefCSROrFI(const MachineInstr &MI, RegScavenger *RS) const;
 
   const SetOfRegs &getCurrentCSRs(RegScavenger *RS) const {
     if (CurrentCSRs.empty()) {
@@ -202,6 +226,7 @@ class ShrinkWrap : public MachineFunctionPass {
     SP = Subtarget.getTargetLowering()->getStackPointerRegisterToSaveRestore();
     Entry = &MF.front();
     CurrentCSRs.clear();
+    UseOrDefCSRCache.clear();
     MachineFunc = &MF;
 
     ++NumFunc;
@@ -257,8 +282,8 @@ INITIALIZE_PASS_DEPENDENCY(MachineLoopInfo)
 INITIALIZE_PASS_DEPENDENCY(MachineOptimizationRemarkEmitterPass)
 INITIALIZE_PASS_END(ShrinkWrap, DEBUG_TYPE, "Shrink Wrap Pass", false, false)
 
-bool ShrinkWrap::useOrDefCSROrFI(const MachineInstr &MI,
-                                 RegScavenger *RS) const {
+bool ShrinkWrap::computeUseOrDefCSROrFI(const MachineInstr &MI,
+                                        RegScavenger *RS) const {
   // This prevents premature stack popping when occurs a indirect stack
   // access. It is overly aggressive for the moment.
   // TODO: - Obvious non-stack loads and store, such as global values,
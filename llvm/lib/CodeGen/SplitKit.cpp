@@ -336,6 +336,14 @@ bool SplitAnalysis::isOriginalEndpoint(SlotIndex Idx) const {
   return I != Orig.begin() && (--I)->end == Idx;
 }
 
+// The analysis is recomputed from scratch even when the same interval comes
+// back from the priority queue unchanged. Caching it across allocator rounds
+// looks attractive but has no reliable invalidation hook: while this interval
+// sat in the queue, spilling or splitting a neighbor may have folded or
+// erased instructions that also use this register, silently editing the use
+// list the analysis is built from. The recomputation is linear in the
+// interval's uses, which is in the noise next to the split cost calculations
+// layered on top of it.
 void SplitAnalysis::analyze(const LiveInterval *li) {
   clear();
   CurLI = li;
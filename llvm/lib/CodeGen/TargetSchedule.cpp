@@ -128,6 +128,14 @@ static unsigned capLatency(int Cycles) {
 
 /// Return the MCSchedClassDesc for this instruction. Some SchedClasses require
 /// evaluation of predicates that depend on instruction operands or flags.
+///
+/// The non-variant path is already a pair of dense array lookups into the
+/// tables SubtargetEmitter generates, so there is nothing left to precompute
+/// for it. The variant loop is the only part that costs anything, and its
+/// result is a function of the concrete instruction - the generated
+/// predicates inspect operands and flags, which is the entire point of
+/// variant classes - so it cannot be memoized per opcode, and a per-MI memo
+/// would go stale the moment a pass rewrites the instruction in place.
 const MCSchedClassDesc *TargetSchedModel::
 resolveSchedClass(const MachineInstr *MI) const {
   // Get the definition's scheduling class descriptor from this machine model.
@@ -2649,6 +2649,18 @@ Error DWARFLinker::link() {
     EmitLambda();
   };
 
+  // The parallelism here is a two-stage pipeline, not an N-way fan-out, and
+  // that is a consequence of how ODR uniquing works rather than an oversight.
+  // Uniquing is first-definition-wins: the first unit to analyze a
+  // declaration context makes it canonical, and every later unit's clone
+  // resolves its type references to the canonical DIE's *output offset*,
+  // which only exists once the earlier unit has been cloned and emitted in
+  // order. Sharding the DeclContextTree by qualified-name hash would let the
+  // analysis race ahead, but the shard merge would have to re-decide
+  // canonical DIEs after clones already baked the losing offsets into
+  // emitted DWARF. Hence clone stays sequential in object order and overlaps
+  // with the analysis of subsequent objects instead.
+  //
   // To limit memory usage in the single threaded case, analyze and clone are
   // run sequentially so the OptContext is freed after processing each object
   // in endDebugObject.
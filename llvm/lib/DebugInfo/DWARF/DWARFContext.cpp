@@ -849,11 +849,12 @@ const DWARFDebugLoc *DWARFContext::getDebugLoc() {
 }
 
 const DWARFDebugAranges *DWARFContext::getDebugAranges() {
-  if (Aranges)
-    return Aranges.get();
-
-  Aranges.reset(new DWARFDebugAranges());
-  Aranges->generate(this);
+  // Once generated the table is immutable and findAddress is lock-free, so
+  // only the first use needs to be guarded against concurrent callers.
+  llvm::call_once(ArangesOnce, [this] {
+    Aranges.reset(new DWARFDebugAranges());
+    Aranges->generate(this);
+  });
   return Aranges.get();
 }
 
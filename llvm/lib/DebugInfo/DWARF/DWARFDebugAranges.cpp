@@ -13,6 +13,7 @@
 #include "llvm/DebugInfo/DWARF/DWARFDebugArangeSet.h"
 #include "llvm/DebugInfo/DWARF/DWARFObject.h"
 #include "llvm/DebugInfo/DWARF/DWARFUnit.h"
+#include "llvm/Support/MathExtras.h"
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
@@ -77,6 +78,9 @@ void DWARFDebugAranges::clear() {
   Endpoints.clear();
   Aranges.clear();
   ParsedCUOffsets.clear();
+  ShardOffsets.clear();
+  ShardBase = 0;
+  ShardShift = 0;
 }
 
 void DWARFDebugAranges::appendRange(uint64_t CUOffset, uint64_t LowPC,
@@ -119,11 +123,45 @@ void DWARFDebugAranges::construct() {
   // Endpoints are not needed now.
   Endpoints.clear();
   Endpoints.shrink_to_fit();
+
+  constructShardIndex();
+}
+
+void DWARFDebugAranges::constructShardIndex() {
+  ShardOffsets.clear();
+  if (Aranges.empty())
+    return;
+
+  // Pick a shard width so that the span of range start addresses is covered
+  // by at most as many shards as there are ranges, capped at 1024 shards.
+  ShardBase = Aranges.front().LowPC;
+  uint64_t Span = Aranges.back().LowPC - ShardBase;
+  uint64_t MaxShards = std::min<uint64_t>(Aranges.size(), 1024);
+  ShardShift = Log2_64_Ceil(Span / MaxShards + 1);
+  uint64_t NumShards = (Span >> ShardShift) + 1;
+
+  // Since the ranges are sorted and disjoint, their end addresses are sorted
+  // too, so each shard's first candidate can be found with a single sweep.
+  ShardOffsets.reserve(NumShards + 1);
+  uint32_t Idx = 0;
+  for (uint64_t S = 0; S != NumShards; ++S) {
+    uint64_t ShardStart = ShardBase + (S << ShardShift);
+    while (Idx != Aranges.size() && Aranges[Idx].HighPC() <= ShardStart)
+      ++Idx;
+    ShardOffsets.push_back(Idx);
+  }
+  ShardOffsets.push_back(Aranges.size());
 }
 
 uint64_t DWARFDebugAranges::findAddress(uint64_t Address) const {
-  RangeCollIterator It =
-      partition_point(Aranges, [=](Range R) { return R.HighPC() <= Address; });
+  if (ShardOffsets.empty() || Address < ShardBase)
+    return -1ULL;
+  uint64_t NumShards = ShardOffsets.size() - 1;
+  uint64_t Shard = std::min((Address - ShardBase) >> ShardShift, NumShards - 1);
+  RangeCollIterator Begin = Aranges.begin() + ShardOffsets[Shard];
+  RangeCollIterator End = Aranges.begin() + ShardOffsets[Shard + 1];
+  RangeCollIterator It = std::partition_point(
+      Begin, End, [=](Range R) { return R.HighPC() <= Address; });
   if (It != Aranges.end() && It->LowPC <= Address)
     return It->CUOffset;
   return -1ULL;
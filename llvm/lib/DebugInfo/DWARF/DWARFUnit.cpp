@@ -483,6 +483,15 @@ void DWARFUnit::extractDIEsIfNeeded(bool CUDieOnly) {
     Context.getRecoverableErrorHandler()(std::move(e));
 }
 
+// Lazy extraction is deliberately unsynchronized: DWARFUnit and DWARFContext
+// are single-threaded by contract. Publishing DieArray atomically would not
+// change that, because extraction also populates the unit's other lazy state
+// (DWO id, addr/range/loclist section bases, the string offsets table
+// contribution, and on-demand split units), and callers retain DWARFDie
+// pointers into the array that clearDIEs() invalidates. Consumers that want
+// parallelism -- DWARFLinker, multi-threaded symbolization -- create one
+// DWARFContext per thread over the same memory buffer; the mapped sections
+// are shared and only the lazily-built indexes are duplicated.
 Error DWARFUnit::tryExtractDIEsIfNeeded(bool CUDieOnly) {
   if ((CUDieOnly && !DieArray.empty()) ||
       DieArray.size() > 1)
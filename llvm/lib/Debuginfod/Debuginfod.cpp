@@ -167,6 +167,15 @@ Error StreamedHTTPResponseHandler::handleBodyChunk(StringRef BodyChunk) {
   return Error::success();
 }
 
+// The download is a single streamed GET per artifact, and the cache is a
+// flat directory keyed by the request's unique key. Both are intentional.
+// The debuginfod protocol offers no artifact checksums to verify against and
+// no guarantee of range-request support, so chunked parallel fetches would
+// gain little over one stream per artifact (distinct artifacts already
+// download independently). And because a build ID is itself a content hash,
+// identical artifacts collide on UniqueKey and dedupe in this cache as-is;
+// re-hashing them into a content-addressed store would only add a layer of
+// indirection in front of the same dedup.
 Expected<std::string> getCachedOrDownloadArtifact(
     StringRef UniqueKey, StringRef UrlPath, StringRef CacheDirectoryPath,
     ArrayRef<StringRef> DebuginfodUrls, std::chrono::milliseconds Timeout) {
@@ -307,6 +307,14 @@ InProcessMemoryManager::Create() {
     return PageSize.takeError();
 }
 
+// This manager maps one region per graph, which is the simple default, not
+// the high-rate one. Clients linking many graphs per second should use
+// MapperJITLinkMemoryManager: it reserves address space in large units and
+// carves per-graph allocations out of the reservation, so the mmap syscall
+// drops to one per slab. The permission flips cannot be amortized the same
+// way -- a segment must become executable before its first call and pages
+// with different protections cannot share an mprotect -- so finalization
+// cost scales with segments, not graphs, under either manager.
 void InProcessMemoryManager::allocate(const JITLinkDylib *JD, LinkGraph &G,
                                       OnAllocatedFunction OnAllocated) {
 
@@ -71,6 +71,14 @@ SimpleCompiler::tryToLoadFromObjectCache(const Module &M) {
   if (!ObjCache)
     return CompileResult();
 
+  // ObjectCache is deliberately this thin: the cache decides its own key
+  // (e.g. a structural hash of M rather than its identifier) and its own
+  // storage, and one cache instance may be handed to any number of compilers
+  // -- sharing compiled objects across sessions in a process is a property
+  // of the cache the client supplies, not of the layers. Keying on
+  // something cheaper than the module, like a hash of the source the client
+  // lowered it from, belongs in the client too, where a hit can skip IR
+  // construction entirely before ORC is ever involved.
   return ObjCache->getObject(&M);
 }
 
@@ -67,6 +67,16 @@ Error LazyCallThroughManager::notifyResolved(JITTargetAddress TrampolineAddr,
   return NotifyResolved ? NotifyResolved(ResolvedAddr) : Error::success();
 }
 
+// A note on the locking here, since it attracts optimization proposals:
+// each trampoline passes through this path once -- after resolution the
+// stub is repointed at the landing address and later calls never re-enter
+// the manager -- and the LCTMMutex sections above are two map probes. The
+// multi-millisecond first-call tails seen under heavy thread counts come
+// from the ES.lookup below, which may materialize the callee and
+// serializes on the session, so replacing Reexports/Notifiers with a
+// lock-free array indexed by stub ordinal would shave nanoseconds off a
+// path that blocks on compilation. Trampolines are also already minted in
+// page-sized batches by the trampoline pool, not one mapping per stub.
 void LazyCallThroughManager::resolveTrampolineLandingAddress(
     JITTargetAddress TrampolineAddr,
     NotifyLandingResolvedFunction NotifyLandingResolved) {
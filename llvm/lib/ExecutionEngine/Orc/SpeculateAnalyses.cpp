@@ -21,6 +21,15 @@
 
 #include <algorithm>
 
+// The queries in this file are deliberately the extent of what lives
+// in-tree. The speculation framework's policy knob is just a function from
+// Function to likely-next symbol names (Speculator's QueryAnalysis), so a
+// production policy that ranks candidates by call-graph reachability crossed
+// with a prior run's observed first-call order plugs in from client code
+// without touching ORC: the host records execution order through its own
+// instrumentation, persists it in whatever store it already has, and hands
+// the lookup in as the query. Keeping persistence out of LLVM also keeps
+// the JIT free of a profile file format and its invalidation policy.
 namespace {
 using namespace llvm;
 SmallVector<const BasicBlock *, 8> findBBwithCalls(const Function &F,
@@ -2263,6 +2263,16 @@ static unsigned CountNumNewlinesBetween(StringRef Range,
   }
 }
 
+// Directives are matched one at a time on purpose, and not compiled into a
+// combined multi-pattern automaton. The regex a directive actually runs is
+// only known at match time: [[VAR]] and numeric [[#expr]] substitutions are
+// spliced into the pattern from captures bound by *earlier* directives, so
+// directive N's pattern text can depend on every match before it. The input
+// is also not rescanned per pattern -- plain CHECKs consume the buffer
+// monotonically, and only DAG/NOT groups re-examine a bounded region between
+// two anchors. What a joint automaton could accelerate is the variable-free
+// subset, at the cost of reconciling its hits with the ordering, same-line,
+// and capture semantics that make up most of this file.
 size_t FileCheckString::Check(const SourceMgr &SM, StringRef Buffer,
                               bool IsLabelScanMode, size_t &MatchLen,
                               FileCheckRequest &Req,
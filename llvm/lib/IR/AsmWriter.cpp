@@ -74,6 +74,8 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/FormattedStream.h"
 #include "llvm/Support/SaveAndRestore.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
@@ -725,11 +727,18 @@ public:
   /// Construct from a module summary index.
   explicit SlotTracker(const ModuleSummaryIndex *Index);
 
-  SlotTracker(const SlotTracker &) = delete;
   SlotTracker &operator=(const SlotTracker &) = delete;
 
   ~SlotTracker() = default;
 
+  /// Clone the current numbering. Used by the parallel function printer:
+  /// each worker incorporates functions into its own clone of the fully
+  /// initialized module-level numbering, so clones agree with each other and
+  /// with the original by construction.
+  std::unique_ptr<SlotTracker> clone() const {
+    return std::unique_ptr<SlotTracker>(new SlotTracker(*this));
+  }
+
   void setProcessHook(
       std::function<void(AbstractSlotTrackerStorage *, const Module *, bool)>);
   void setProcessHook(std::function<void(AbstractSlotTrackerStorage *,
@@ -788,6 +797,8 @@ public:
 
   // Implementation Details
 private:
+  SlotTracker(const SlotTracker &) = default;
+
   /// CreateModuleSlot - Insert the specified GlobalValue* into the slot table.
   void CreateModuleSlot(const GlobalValue *V);
 
@@ -2536,6 +2547,7 @@ class AssemblyWriter {
   SetVector<const Comdat *> Comdats;
   bool IsForDebug;
   bool ShouldPreserveUseListOrder;
+  unsigned PrintThreads;
   UseListOrderMap UseListOrders;
   SmallVector<StringRef, 8> MDNames;
   /// Synchronization scope names registered with LLVMContext.
@@ -2546,7 +2558,8 @@ public:
   /// Construct an AssemblyWriter with an external SlotTracker
   AssemblyWriter(formatted_raw_ostream &o, SlotTracker &Mac, const Module *M,
                  AssemblyAnnotationWriter *AAW, bool IsForDebug,
-                 bool ShouldPreserveUseListOrder = false);
+                 bool ShouldPreserveUseListOrder = false,
+                 unsigned PrintThreads = 1);
 
   AssemblyWriter(formatted_raw_ostream &o, SlotTracker &Mac,
                  const ModuleSummaryIndex *Index, bool IsForDebug);
@@ -2559,6 +2572,7 @@ public:
   void printNamedMDNode(const NamedMDNode *NMD);
 
   void printModule(const Module *M);
+  void printFunctionsParallel();
 
   void writeOperand(const Value *Op, bool PrintType);
   void writeParamOperand(const Value *Operand, AttributeSet Attrs);
@@ -2632,10 +2646,12 @@ private:
 
 AssemblyWriter::AssemblyWriter(formatted_raw_ostream &o, SlotTracker &Mac,
                                const Module *M, AssemblyAnnotationWriter *AAW,
-                               bool IsForDebug, bool ShouldPreserveUseListOrder)
+                               bool IsForDebug, bool ShouldPreserveUseListOrder,
+                               unsigned PrintThreads)
     : Out(o), TheModule(M), Machine(Mac), TypePrinter(M), AnnotationWriter(AAW),
       IsForDebug(IsForDebug),
-      ShouldPreserveUseListOrder(ShouldPreserveUseListOrder) {
+      ShouldPreserveUseListOrder(ShouldPreserveUseListOrder),
+      PrintThreads(PrintThreads) {
   if (!TheModule)
     return;
   for (const GlobalObject &GO : TheModule->global_objects())
@@ -2646,7 +2662,8 @@ AssemblyWriter::AssemblyWriter(formatted_raw_ostream &o, SlotTracker &Mac,
 AssemblyWriter::AssemblyWriter(formatted_raw_ostream &o, SlotTracker &Mac,
                                const ModuleSummaryIndex *Index, bool IsForDebug)
     : Out(o), TheIndex(Index), Machine(Mac), TypePrinter(/*Module=*/nullptr),
-      IsForDebug(IsForDebug), ShouldPreserveUseListOrder(false) {}
+      IsForDebug(IsForDebug), ShouldPreserveUseListOrder(false),
+      PrintThreads(1) {}
 
 void AssemblyWriter::writeOperand(const Value *Operand, bool PrintType) {
   if (!Operand) {
@@ -2828,9 +2845,13 @@ void AssemblyWriter::printModule(const Module *M) {
     printIFunc(&GI);
 
   // Output all of the functions.
-  for (const Function &F : *M) {
-    Out << '\n';
-    printFunction(&F);
+  if (PrintThreads > 1 && !AnnotationWriter && !ShouldPreserveUseListOrder) {
+    printFunctionsParallel();
+  } else {
+    for (const Function &F : *M) {
+      Out << '\n';
+      printFunction(&F);
+    }
   }
 
   // Output global use-lists.
@@ -2855,6 +2876,51 @@ void AssemblyWriter::printModule(const Module *M) {
   }
 }
 
+void AssemblyWriter::printFunctionsParallel() {
+  // Functions print independently once slot numbering is fixed, but the
+  // sequential printer assigns metadata and attribute-group slots lazily as
+  // functions are incorporated. Force the complete numbering up front so each
+  // worker's clone of the tracker agrees with the numbering the module-level
+  // tables are printed with below.
+  for (const Function &F : *TheModule) {
+    Machine.incorporateFunction(&F);
+    Machine.initializeIfNeeded();
+    Machine.purgeFunction();
+  }
+
+  SmallVector<const Function *, 0> Funcs;
+  for (const Function &F : *TheModule)
+    Funcs.push_back(&F);
+  if (Funcs.empty())
+    return;
+
+  // Render contiguous runs of functions into per-worker buffers and stitch
+  // them in order. One clone of the slot tracker per worker, not per
+  // function: cloning the numbering of a large module is not free.
+  unsigned NumWorkers = std::min<size_t>(PrintThreads, Funcs.size());
+  std::vector<std::string> Buffers(NumWorkers);
+  ThreadPool Pool(hardware_concurrency(NumWorkers));
+  for (unsigned Worker = 0; Worker != NumWorkers; ++Worker) {
+    size_t Begin = Funcs.size() * Worker / NumWorkers;
+    size_t End = Funcs.size() * (Worker + 1) / NumWorkers;
+    Pool.async([this, &Funcs, &Buffers, Worker, Begin, End] {
+      raw_string_ostream SOS(Buffers[Worker]);
+      formatted_raw_ostream FOS(SOS);
+      std::unique_ptr<SlotTracker> LocalMachine = Machine.clone();
+      AssemblyWriter LocalWriter(FOS, *LocalMachine, TheModule,
+                                 /*AAW=*/nullptr, IsForDebug);
+      for (size_t I = Begin; I != End; ++I) {
+        FOS << '\n';
+        LocalWriter.printFunction(Funcs[I]);
+      }
+    });
+  }
+  Pool.wait();
+
+  for (const std::string &Buffer : Buffers)
+    Out << Buffer;
+}
+
 void AssemblyWriter::printModuleSummaryIndex() {
   assert(TheIndex);
   int NumSlots = Machine.initializeIndexIfNeeded();
@@ -4509,11 +4575,12 @@ void BasicBlock::print(raw_ostream &ROS, AssemblyAnnotationWriter *AAW,
 }
 
 void Module::print(raw_ostream &ROS, AssemblyAnnotationWriter *AAW,
-                   bool ShouldPreserveUseListOrder, bool IsForDebug) const {
+                   bool ShouldPreserveUseListOrder, bool IsForDebug,
+                   unsigned PrintThreads) const {
   SlotTracker SlotTable(this);
   formatted_raw_ostream OS(ROS);
   AssemblyWriter W(OS, SlotTable, this, AAW, IsForDebug,
-                   ShouldPreserveUseListOrder);
+                   ShouldPreserveUseListOrder, PrintThreads);
   W.printModule(this);
 }
 
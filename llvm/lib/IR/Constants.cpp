@@ -670,15 +670,23 @@ Constant::PossibleRelocationsTy Constant::getRelocationInfo() const {
 /// Return true if the specified constantexpr is dead. This involves
 /// recursively traversing users of the constantexpr.
 /// If RemoveDeadUsers is true, also remove dead users at the same time.
-static bool constantIsDead(const Constant *C, bool RemoveDeadUsers) {
+/// LiveConstants memoizes constants already proven live during this scan so
+/// that shared subgraphs of constant users are traversed at most once; only
+/// live constants are recorded, which is safe because they are never
+/// destroyed while the scan runs.
+static bool constantIsDead(const Constant *C, bool RemoveDeadUsers,
+                           SmallPtrSetImpl<const Constant *> &LiveConstants) {
   if (isa<GlobalValue>(C)) return false; // Cannot remove this
+  if (LiveConstants.count(C))
+    return false; // Already known to be live.
 
   Value::const_user_iterator I = C->user_begin(), E = C->user_end();
   while (I != E) {
     const Constant *User = dyn_cast<Constant>(*I);
-    if (!User) return false; // Non-constant usage;
-    if (!constantIsDead(User, RemoveDeadUsers))
-      return false; // Constant wasn't dead
+    if (!User || !constantIsDead(User, RemoveDeadUsers, LiveConstants)) {
+      LiveConstants.insert(C);
+      return false; // Non-constant usage or constant wasn't dead.
+    }
 
     // Just removed User, so the iterator was invalidated.
     // Since we return immediately upon finding a live user, we can always
@@ -700,6 +708,7 @@ static bool constantIsDead(const Constant *C, bool RemoveDeadUsers) {
 }
 
 void Constant::removeDeadConstantUsers() const {
+  SmallPtrSet<const Constant *, 16> LiveConstants;
   Value::const_user_iterator I = user_begin(), E = user_end();
   Value::const_user_iterator LastNonDeadUser = E;
   while (I != E) {
@@ -710,7 +719,7 @@ void Constant::removeDeadConstantUsers() const {
       continue;
     }
 
-    if (!constantIsDead(User, /* RemoveDeadUsers= */ true)) {
+    if (!constantIsDead(User, /* RemoveDeadUsers= */ true, LiveConstants)) {
       // If the constant wasn't dead, remember that this was the last live use
       // and move on to the next constant.
       LastNonDeadUser = I;
@@ -731,10 +740,12 @@ bool Constant::hasOneLiveUse() const { return hasNLiveUses(1); }
 bool Constant::hasZeroLiveUses() const { return hasNLiveUses(0); }
 
 bool Constant::hasNLiveUses(unsigned N) const {
+  SmallPtrSet<const Constant *, 16> LiveConstants;
   unsigned NumUses = 0;
   for (const Use &U : uses()) {
     const Constant *User = dyn_cast<Constant>(U.getUser());
-    if (!User || !constantIsDead(User, /* RemoveDeadUsers= */ false)) {
+    if (!User || !constantIsDead(User, /* RemoveDeadUsers= */ false,
+                                 LiveConstants)) {
       ++NumUses;
 
       if (NumUses > N)
@@ -864,15 +875,18 @@ Constant *ConstantInt::getBool(Type *Ty, bool V) {
 
 // Get a ConstantInt from an APInt.
 ConstantInt *ConstantInt::get(LLVMContext &Context, const APInt &V) {
-  // get an existing value or the insertion position
   LLVMContextImpl *pImpl = Context.pImpl;
+  // Get the corresponding integer type for the bit width of the value up
+  // front so the type table is not touched while the constant table lock is
+  // held.
+  IntegerType *ITy = IntegerType::get(Context, V.getBitWidth());
+  // get an existing value or the insertion position
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->IntConstantsLock);
   std::unique_ptr<ConstantInt> &Slot = pImpl->IntConstants[V];
-  if (!Slot) {
-    // Get the corresponding integer type for the bit width of the value.
-    IntegerType *ITy = IntegerType::get(Context, V.getBitWidth());
+  if (!Slot)
     Slot.reset(new ConstantInt(ITy, V));
-  }
-  assert(Slot->getType() == IntegerType::get(Context, V.getBitWidth()));
+  assert(Slot->getType() == ITy);
   return Slot.get();
 }
 
@@ -1020,6 +1034,8 @@ Constant *ConstantFP::getZeroValueForNegation(Type *Ty) {
 ConstantFP* ConstantFP::get(LLVMContext &Context, const APFloat& V) {
   LLVMContextImpl* pImpl = Context.pImpl;
 
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->FPConstantsLock);
   std::unique_ptr<ConstantFP> &Slot = pImpl->FPConstants[V];
 
   if (!Slot) {
@@ -1420,6 +1436,8 @@ Constant *ConstantVector::getSplat(ElementCount EC, Constant *V) {
 
 ConstantTokenNone *ConstantTokenNone::get(LLVMContext &Context) {
   LLVMContextImpl *pImpl = Context.pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
   if (!pImpl->TheNoneToken)
     pImpl->TheNoneToken.reset(new ConstantTokenNone(Context));
   return pImpl->TheNoneToken.get();
@@ -1590,8 +1608,10 @@ ConstantAggregateZero *ConstantAggregateZero::get(Type *Ty) {
   assert((Ty->isStructTy() || Ty->isArrayTy() || Ty->isVectorTy()) &&
          "Cannot create an aggregate zero of non-aggregate type!");
 
-  std::unique_ptr<ConstantAggregateZero> &Entry =
-      Ty->getContext().pImpl->CAZConstants[Ty];
+  LLVMContextImpl *pImpl = Ty->getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
+  std::unique_ptr<ConstantAggregateZero> &Entry = pImpl->CAZConstants[Ty];
   if (!Entry)
     Entry.reset(new ConstantAggregateZero(Ty));
 
@@ -1600,7 +1620,10 @@ ConstantAggregateZero *ConstantAggregateZero::get(Type *Ty) {
 
 /// Remove the constant from the constant table.
 void ConstantAggregateZero::destroyConstantImpl() {
-  getContext().pImpl->CAZConstants.erase(getType());
+  LLVMContextImpl *pImpl = getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
+  pImpl->CAZConstants.erase(getType());
 }
 
 /// Remove the constant from the constant table.
@@ -1694,8 +1717,10 @@ const APInt &Constant::getUniqueInteger() const {
 //
 
 ConstantPointerNull *ConstantPointerNull::get(PointerType *Ty) {
-  std::unique_ptr<ConstantPointerNull> &Entry =
-      Ty->getContext().pImpl->CPNConstants[Ty];
+  LLVMContextImpl *pImpl = Ty->getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
+  std::unique_ptr<ConstantPointerNull> &Entry = pImpl->CPNConstants[Ty];
   if (!Entry)
     Entry.reset(new ConstantPointerNull(Ty));
 
@@ -1704,11 +1729,17 @@ ConstantPointerNull *ConstantPointerNull::get(PointerType *Ty) {
 
 /// Remove the constant from the constant table.
 void ConstantPointerNull::destroyConstantImpl() {
-  getContext().pImpl->CPNConstants.erase(getType());
+  LLVMContextImpl *pImpl = getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
+  pImpl->CPNConstants.erase(getType());
 }
 
 UndefValue *UndefValue::get(Type *Ty) {
-  std::unique_ptr<UndefValue> &Entry = Ty->getContext().pImpl->UVConstants[Ty];
+  LLVMContextImpl *pImpl = Ty->getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
+  std::unique_ptr<UndefValue> &Entry = pImpl->UVConstants[Ty];
   if (!Entry)
     Entry.reset(new UndefValue(Ty));
 
@@ -1718,16 +1749,22 @@ UndefValue *UndefValue::get(Type *Ty) {
 /// Remove the constant from the constant table.
 void UndefValue::destroyConstantImpl() {
   // Free the constant and any dangling references to it.
+  LLVMContextImpl *pImpl = getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
   if (getValueID() == UndefValueVal) {
-    getContext().pImpl->UVConstants.erase(getType());
+    pImpl->UVConstants.erase(getType());
   } else if (getValueID() == PoisonValueVal) {
-    getContext().pImpl->PVConstants.erase(getType());
+    pImpl->PVConstants.erase(getType());
   }
   llvm_unreachable("Not a undef or a poison!");
 }
 
 PoisonValue *PoisonValue::get(Type *Ty) {
-  std::unique_ptr<PoisonValue> &Entry = Ty->getContext().pImpl->PVConstants[Ty];
+  LLVMContextImpl *pImpl = Ty->getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
+  std::unique_ptr<PoisonValue> &Entry = pImpl->PVConstants[Ty];
   if (!Entry)
     Entry.reset(new PoisonValue(Ty));
 
@@ -1737,7 +1774,10 @@ PoisonValue *PoisonValue::get(Type *Ty) {
 /// Remove the constant from the constant table.
 void PoisonValue::destroyConstantImpl() {
   // Free the constant and any dangling references to it.
-  getContext().pImpl->PVConstants.erase(getType());
+  LLVMContextImpl *pImpl = getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->TypeSingletonConstantsLock);
+  pImpl->PVConstants.erase(getType());
 }
 
 BlockAddress *BlockAddress::get(BasicBlock *BB) {
@@ -2908,10 +2948,11 @@ Constant *ConstantDataSequential::getImpl(StringRef Elements, Type *Ty) {
     return ConstantAggregateZero::get(Ty);
 
   // Do a lookup to see if we have already formed one of these.
+  LLVMContextImpl *pImpl = Ty->getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->CDSConstantsLock);
   auto &Slot =
-      *Ty->getContext()
-           .pImpl->CDSConstants.insert(std::make_pair(Elements, nullptr))
-           .first;
+      *pImpl->CDSConstants.insert(std::make_pair(Elements, nullptr)).first;
 
   // The bucket can point to a linked list of different CDS's that have the same
   // body but different types.  For example, 0,0,0,1 could be a 4 element array
@@ -2938,8 +2979,11 @@ Constant *ConstantDataSequential::getImpl(StringRef Elements, Type *Ty) {
 
 void ConstantDataSequential::destroyConstantImpl() {
   // Remove the constant from the StringMap.
+  LLVMContextImpl *pImpl = getType()->getContext().pImpl;
+  std::unique_lock<std::mutex> Guard =
+      pImpl->lockConstantTable(pImpl->CDSConstantsLock);
   StringMap<std::unique_ptr<ConstantDataSequential>> &CDSConstants =
-      getType()->getContext().pImpl->CDSConstants;
+      pImpl->CDSConstants;
 
   auto Slot = CDSConstants.find(getRawDataValues());
 
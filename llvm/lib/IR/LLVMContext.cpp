@@ -353,6 +353,22 @@ void LLVMContext::setDiscardValueNames(bool Discard) {
   pImpl->DiscardValueNames = Discard;
 }
 
+bool LLVMContext::hasArenaAllocatedMetadata() const {
+  return pImpl->ArenaAllocatedMetadata;
+}
+
+void LLVMContext::setArenaAllocatedMetadata(bool Enable) {
+  pImpl->ArenaAllocatedMetadata = Enable;
+}
+
+bool LLVMContext::hasConcurrentConstantUniquing() const {
+  return pImpl->ConcurrentConstantUniquing;
+}
+
+void LLVMContext::setConcurrentConstantUniquing(bool Enable) {
+  pImpl->ConcurrentConstantUniquing = Enable;
+}
+
 OptPassGate &LLVMContext::getOptPassGate() const {
   return pImpl->getOptPassGate();
 }
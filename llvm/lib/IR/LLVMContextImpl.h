@@ -47,6 +47,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -1403,6 +1404,41 @@ public:
 
   DenseMap<const Value *, ValueName *> ValueNames;
 
+  /// When true, non-temporary metadata nodes are allocated from Alloc and
+  /// freed wholesale at context teardown instead of being individually
+  /// new'ed and delete'd.  Intended for short-lived contexts (e.g. per-module
+  /// ThinLTO backends) where teardown free() traffic is significant.  Memory
+  /// for nodes destroyed before teardown (uniquing replacements) is not
+  /// recycled until the context dies.
+  bool ArenaAllocatedMetadata = false;
+
+  /// When true, the uniquing tables for operand-free constants (ConstantInt,
+  /// ConstantFP, ConstantAggregateZero, ConstantPointerNull, UndefValue,
+  /// PoisonValue, ConstantTokenNone, ConstantDataSequential) and the integer
+  /// type table are guarded by per-table locks so multiple threads may create
+  /// such constants in this context concurrently.  Constants with operands
+  /// (aggregates, constant expressions) splice into their operands' use lists
+  /// and remain single-threaded, as does all other context state.
+  bool ConcurrentConstantUniquing = false;
+
+  /// Per-table locks for the tables above; only engaged when
+  /// ConcurrentConstantUniquing is set.  The per-type singleton tables (zero
+  /// aggregates, null pointers, undef/poison, the none token) see little
+  /// traffic and share one lock.
+  std::mutex IntConstantsLock;
+  std::mutex FPConstantsLock;
+  std::mutex CDSConstantsLock;
+  std::mutex TypeSingletonConstantsLock;
+  std::mutex IntegerTypesLock;
+
+  /// Return a lock on \p M when concurrent constant uniquing is enabled and
+  /// an empty (unlocked) guard otherwise.
+  std::unique_lock<std::mutex> lockConstantTable(std::mutex &M) {
+    if (ConcurrentConstantUniquing)
+      return std::unique_lock<std::mutex>(M);
+    return std::unique_lock<std::mutex>();
+  }
+
   using IntMapTy =
       DenseMap<APInt, std::unique_ptr<ConstantInt>, DenseMapAPIntKeyInfo>;
   IntMapTy IntConstants;
@@ -522,21 +522,35 @@ StringRef MDString::getString() const {
       "Alignment is insufficient after objects prepended to " #CLASS);
 #include "llvm/IR/Metadata.def"
 
-void *MDNode::operator new(size_t Size, size_t NumOps, StorageType Storage) {
+void *MDNode::operator new(size_t Size, size_t NumOps, StorageType Storage,
+                           LLVMContext &Context) {
   // uint64_t is the most aligned type we need support (ensured by static_assert
   // above)
   size_t AllocSize =
       alignTo(Header::getAllocSize(Storage, NumOps), alignof(uint64_t));
-  char *Mem = reinterpret_cast<char *>(::operator new(AllocSize + Size));
+  // Temporary nodes are designed to be created and deleted in bulk (e.g. by
+  // DIBuilder's forward declarations), so they keep using the heap even in
+  // arena mode; everything else lives until context teardown.
+  bool UseArena =
+      Storage != Temporary && Context.pImpl->ArenaAllocatedMetadata;
+  char *Mem = reinterpret_cast<char *>(
+      UseArena ? Context.pImpl->Alloc.Allocate(AllocSize + Size,
+                                               alignof(uint64_t))
+               : ::operator new(AllocSize + Size));
   Header *H = new (Mem + AllocSize - sizeof(Header)) Header(NumOps, Storage);
+  H->IsArenaAllocated = UseArena;
   return reinterpret_cast<void *>(H + 1);
 }
 
 void MDNode::operator delete(void *N) {
   Header *H = reinterpret_cast<Header *>(N) - 1;
   void *Mem = H->getAllocation();
+  bool WasArenaAllocated = H->IsArenaAllocated;
   H->~Header();
-  ::operator delete(Mem);
+  // Arena-allocated nodes are freed wholesale when the context's allocator
+  // is torn down.
+  if (!WasArenaAllocated)
+    ::operator delete(Mem);
 }
 
 MDNode::MDNode(LLVMContext &Context, unsigned ID, StorageType Storage,
@@ -570,6 +584,7 @@ TempMDNode MDNode::clone() const {
 MDNode::Header::Header(size_t NumOps, StorageType Storage) {
   IsLarge = isLarge(NumOps);
   IsResizable = isResizable(Storage);
+  IsArenaAllocated = false;
   SmallSize = getSmallSize(NumOps, IsResizable, IsLarge);
   if (IsLarge) {
     SmallNumOps = 0;
@@ -933,7 +948,7 @@ MDTuple *MDTuple::getImpl(LLVMContext &Context, ArrayRef<Metadata *> MDs,
     assert(ShouldCreate && "Expected non-uniqued nodes to always be created");
   }
 
-  return storeImpl(new (MDs.size(), Storage)
+  return storeImpl(new (MDs.size(), Storage, Context)
                        MDTuple(Context, Storage, Hash, MDs),
                    Storage, Context.pImpl->MDTuples);
 }
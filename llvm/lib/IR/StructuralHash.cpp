@@ -21,6 +21,18 @@ namespace details {
 // Basic hashing mechanism to detect structural change to the IR, used to verify
 // pass return status consistency with actual change. Loosely copied from
 // llvm/lib/Transforms/Utils/FunctionComparator.cpp
+//
+// The coarseness is intentional, and this is not the seed of a general
+// caching hash. It runs after every pass under EXPENSIVE_CHECKS, so it
+// favors speed over fidelity; a cryptographic, full-fidelity digest would
+// make the checks build slower for no additional verification power. Nor
+// can any such hash be maintained incrementally from the pass manager:
+// passes mutate IR through plain pointers with no change journal to replay,
+// so "incremental" hooks would devolve into rehashing every function a pass
+// visited. Equality-hungry clients have their own tools already --
+// MergeFunctions buckets by FunctionComparator::functionHash and deep
+// compares only within a bucket, since a merge needs proven equivalence
+// rather than a probabilistic one.
 
 class StructuralHash {
   uint64_t Hash = 0x6acaa36bef8325c5ULL;
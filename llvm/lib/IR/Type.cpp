@@ -324,6 +324,8 @@ IntegerType *IntegerType::get(LLVMContext &C, unsigned NumBits) {
     break;
   }
 
+  std::unique_lock<std::mutex> Guard =
+      C.pImpl->lockConstantTable(C.pImpl->IntegerTypesLock);
   IntegerType *&Entry = C.pImpl->IntegerTypes[NumBits];
 
   if (!Entry)
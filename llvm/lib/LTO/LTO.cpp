@@ -1184,7 +1184,14 @@ public:
   virtual Error wait() = 0;
   virtual unsigned getThreadCount() = 0;
 
-  // Write sharded indices and (optionally) imports to disk
+  // Write sharded indices and (optionally) imports to disk.
+  //
+  // Slicing happens here, at thin-link time, rather than in the reader: each
+  // backend job gets a <module>.thinlto.bc containing only the summaries its
+  // import list can reach, so a distributed backend never parses the full
+  // combined index no matter how large it grows. This is why the bitcode
+  // summary format needs no GUID directory for partial loads — the slice for
+  // a small module is itself small.
   Error emitFiles(const FunctionImporter::ImportMapTy &ImportList,
                   llvm::StringRef ModulePath,
                   const std::string &NewModulePath) {
@@ -1434,6 +1441,15 @@ ThinBackend lto::createWriteIndexesThinBackend(
   };
 }
 
+// The thin link runs in this single process even when the backends are
+// distributed. Its core passes are whole-graph computations — dead-symbol
+// marking is a reachability fixed point from the preserved roots, and import
+// decisions chase edges across arbitrary module boundaries with decaying
+// thresholds — so partitioning them over machines would need iterative
+// exchange of boundary summaries until convergence, trading one machine's
+// graph walk for rounds of serialization of comparable size. Keeping the
+// summaries compact enough to traverse on one machine is the intended
+// scaling model.
 Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
                       const DenseSet<GlobalValue::GUID> &GUIDPreservedSymbols) {
   timeTraceProfilerBegin("ThinLink", StringRef(""));
@@ -414,6 +414,12 @@ static void codegen(const Config &Conf, TargetMachine *TM,
     DwoOut->keep();
 }
 
+// Partitions are pipelined with codegen: SplitModule invokes the callback as
+// soon as each partition is cloned, so its codegen job is already running on
+// the pool while the main thread clones and serializes the next partition.
+// Only the clone and the bitcode round-trip stay on the main thread — both
+// read the original module's LLVMContext, whose uniquing tables are not
+// thread-safe to share with the ongoing split.
 static void splitCodeGen(const Config &C, TargetMachine *TM,
                          AddStreamFn AddStream,
                          unsigned ParallelCodeGenParallelismLevel, Module &Mod,
@@ -619,8 +625,12 @@ Error lto::thinBackend(const Config &Conf, unsigned Task, AddStreamFn AddStream,
                                      /*IsImporting*/ true);
     }
 
+    // Bitcode is parsed front to back; declare the pattern so the kernel can
+    // read ahead of the parser on cold caches.
     ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> MBOrErr =
-        llvm::MemoryBuffer::getFile(Identifier);
+        llvm::MemoryBuffer::getFile(
+            Identifier, /*IsText=*/false, /*RequiresNullTerminator=*/true,
+            /*IsVolatile=*/false, MemoryBuffer::AccessPattern::Sequential);
     if (!MBOrErr)
       return Expected<std::unique_ptr<llvm::Module>>(make_error<StringError>(
           Twine("Error loading imported file ") + Identifier + " : ",
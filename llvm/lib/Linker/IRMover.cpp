@@ -8,6 +8,7 @@
 
 #include "llvm/Linker/IRMover.h"
 #include "LinkDiagnosticInfo.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallString.h"
@@ -54,6 +55,12 @@ class TypeMapTy : public ValueMapTypeRemapper {
   /// getting a body from the source module.
   SmallPtrSet<StructType *, 16> DstResolvedOpaqueTypes;
 
+  /// Cached structural fingerprints used to reject non-isomorphic type pairs
+  /// without a deep walk.  A value of 0 means the type's graph reaches an
+  /// opaque struct (which may legally unify with any struct body), so the
+  /// fingerprint must not be used to reject a pairing.
+  DenseMap<Type *, uint64_t> Fingerprints;
+
 public:
   TypeMapTy(IRMover::IdentifiedStructTypeSet &DstStructTypesSet)
       : DstStructTypesSet(DstStructTypesSet) {}
@@ -81,17 +88,87 @@ public:
 private:
   Type *remapType(Type *SrcTy) override { return get(SrcTy); }
 
+  uint64_t getTypeFingerprint(Type *Ty);
+  bool mayBeIsomorphic(Type *DstTy, Type *SrcTy);
   bool areTypesIsomorphic(Type *DstTy, Type *SrcTy);
 };
 }
 
+/// Bounds on how much of a type graph the structural fingerprint examines.
+/// They only trade precision for speed; truncation keeps the hash sound.
+enum : unsigned { FingerprintMaxDepth = 8, FingerprintMaxNodes = 256 };
+
+/// Compute a hash of the shape of \p Ty, recursing into contained types up to
+/// a bounded depth and node count (struct names are ignored, so the bounds
+/// also terminate recursive types).  Isomorphic types always hash equally;
+/// differing hashes prove two types cannot be isomorphic.  If an opaque
+/// struct is reachable, \p Tainted is set: such a type may unify with
+/// arbitrary struct bodies, so its hash proves nothing.
+static uint64_t hashTypeShape(Type *Ty, unsigned Depth, unsigned &Budget,
+                              bool &Tainted) {
+  if (Depth == 0 || Budget == 0)
+    return 0;
+  --Budget;
+
+  uint64_t H = Ty->getTypeID();
+  if (auto *IT = dyn_cast<IntegerType>(Ty))
+    return hash_combine(H, IT->getBitWidth());
+  if (auto *PT = dyn_cast<PointerType>(Ty))
+    H = hash_combine(H, PT->getAddressSpace());
+  else if (auto *AT = dyn_cast<ArrayType>(Ty))
+    H = hash_combine(H, AT->getNumElements());
+  else if (auto *VT = dyn_cast<VectorType>(Ty))
+    H = hash_combine(H, VT->getElementCount().getKnownMinValue(),
+                     VT->getElementCount().isScalable());
+  else if (auto *FT = dyn_cast<FunctionType>(Ty))
+    H = hash_combine(H, FT->isVarArg());
+  else if (auto *ST = dyn_cast<StructType>(Ty)) {
+    if (ST->isOpaque()) {
+      Tainted = true;
+      return H;
+    }
+    H = hash_combine(H, ST->isLiteral(), ST->isPacked(), ST->getNumElements());
+  }
+
+  for (Type *ElTy : Ty->subtypes())
+    H = hash_combine(H, hashTypeShape(ElTy, Depth - 1, Budget, Tainted));
+  return H;
+}
+
+uint64_t TypeMapTy::getTypeFingerprint(Type *Ty) {
+  auto It = Fingerprints.find(Ty);
+  if (It != Fingerprints.end())
+    return It->second;
+
+  bool Tainted = false;
+  unsigned Budget = FingerprintMaxNodes;
+  uint64_t FP = hashTypeShape(Ty, FingerprintMaxDepth, Budget, Tainted);
+  FP = Tainted ? 0 : (FP ? FP : 1);
+  // Caching is safe even though opaque structs can acquire a body later:
+  // a tainted fingerprint just stays unused, and an untainted one only covers
+  // types whose graphs cannot be mutated (setBody is limited to opaque
+  // structs, which taint every graph that reaches them).
+  return Fingerprints[Ty] = FP;
+}
+
+/// Return false only if the two types provably cannot be isomorphic, without
+/// walking the type graphs pairwise.
+bool TypeMapTy::mayBeIsomorphic(Type *DstTy, Type *SrcTy) {
+  uint64_t DstFP = getTypeFingerprint(DstTy);
+  if (!DstFP)
+    return true;
+  uint64_t SrcFP = getTypeFingerprint(SrcTy);
+  return !SrcFP || DstFP == SrcFP;
+}
+
 void TypeMapTy::addTypeMapping(Type *DstTy, Type *SrcTy) {
   assert(SpeculativeTypes.empty());
   assert(SpeculativeDstOpaqueTypes.empty());
 
   // Check to see if these types are recursively isomorphic and establish a
-  // mapping between them if so.
-  if (!areTypesIsomorphic(DstTy, SrcTy)) {
+  // mapping between them if so.  Consult the structural fingerprints first so
+  // that mismatched pairs are usually rejected without a deep walk.
+  if (!mayBeIsomorphic(DstTy, SrcTy) || !areTypesIsomorphic(DstTy, SrcTy)) {
     // Oops, they aren't isomorphic.  Just discard this request by rolling out
     // any speculative mappings we've established.
     for (Type *Ty : SpeculativeTypes)
@@ -393,6 +470,14 @@ class IRLinker {
   LocalValueMaterializer LValMaterializer;
 
   /// A metadata map that's shared between IRLinker instances.
+  ///
+  /// Carrying this across moves is what keeps repeated imports from
+  /// re-remapping common debug info: together with the uniqued-subgraph walk
+  /// in MDNodeMapper — which identity-maps any node whose transitive operands
+  /// are unchanged — a source node that matches destination metadata maps to
+  /// the existing node without cloning. Since imports load source modules
+  /// into the destination context, equal uniqued nodes are already pointer
+  /// identical, so no separate content hash is needed to detect the match.
   MDMapT &SharedMDs;
 
   /// Mapping of values from what they used to be in Src, to what they are now
@@ -912,6 +912,30 @@ void ELFWriter::writeRelocations(const MCAssembler &Asm,
   OWriter.TargetObjectWriter->sortRelocs(Asm, Relocs);
 
   const bool Rela = usesRela(Sec);
+
+  // Fast path for the common 64-bit non-MIPS case: the records are fixed
+  // size, so stage the whole section in one contiguous buffer and hand it to
+  // the stream in a single write. Debug-info-heavy objects carry millions of
+  // relocations, and the per-field stream appends dominate their emission.
+  if (is64Bit() && OWriter.TargetObjectWriter->getEMachine() != ELF::EM_MIPS) {
+    SmallVector<char, 0> Storage;
+    Storage.reserve(Relocs.size() *
+                    (Rela ? sizeof(ELF::Elf64_Rela) : sizeof(ELF::Elf64_Rel)));
+    raw_svector_ostream VecOS(Storage);
+    support::endian::Writer BW(VecOS, W.Endian);
+    for (const ELFRelocationEntry &Entry : llvm::reverse(Relocs)) {
+      unsigned Index = Entry.Symbol ? Entry.Symbol->getIndex() : 0;
+      BW.write(Entry.Offset);
+      struct ELF::Elf64_Rela ERE64;
+      ERE64.setSymbolAndType(Index, Entry.Type);
+      BW.write(ERE64.r_info);
+      if (Rela)
+        BW.write(Entry.Addend);
+    }
+    W.OS << VecOS.str();
+    return;
+  }
+
   for (unsigned i = 0, e = Relocs.size(); i != e; ++i) {
     const ELFRelocationEntry &Entry = Relocs[e - i - 1];
     unsigned Index = Entry.Symbol ? Entry.Symbol->getIndex() : 0;
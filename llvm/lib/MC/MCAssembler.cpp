@@ -806,6 +806,23 @@ MCAssembler::handleFixup(const MCAsmLayout &Layout, MCFragment &F,
   return std::make_tuple(Target, FixedValue, IsResolved);
 }
 
+/// Check whether \p F is a fragment kind that relaxFragment can resize.
+static bool isRelaxableFragment(const MCFragment &F) {
+  switch (F.getKind()) {
+  default:
+    return false;
+  case MCFragment::FT_Relaxable:
+  case MCFragment::FT_Dwarf:
+  case MCFragment::FT_DwarfFrame:
+  case MCFragment::FT_LEB:
+  case MCFragment::FT_BoundaryAlign:
+  case MCFragment::FT_CVInlineLines:
+  case MCFragment::FT_CVDefRange:
+  case MCFragment::FT_PseudoProbe:
+    return true;
+  }
+}
+
 void MCAssembler::layout(MCAsmLayout &Layout) {
   assert(getBackendPtr() && "Expected assembler backend");
   DEBUG_WITH_TYPE("mc-dump", {
@@ -833,8 +850,21 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
       Frag.setLayoutOrder(FragmentIndex++);
   }
 
+  // Fragment kinds are fixed once emission is done; relaxation only changes
+  // the contents and sizes of the fragments that can relax. Collect the
+  // sections containing at least one such fragment so that the fixed-point
+  // loop below does not rescan sections made purely of data on every
+  // iteration. Note that relaxation cannot be run on sections in parallel:
+  // evaluating a fixup lazily lays out whichever sections the referenced
+  // symbols live in, so sections are only independent once a fixed point has
+  // been reached.
+  SmallVector<MCSection *, 16> RelaxableSections;
+  for (MCSection &Sec : *this)
+    if (llvm::any_of(Sec, isRelaxableFragment))
+      RelaxableSections.push_back(&Sec);
+
   // Layout until everything fits.
-  while (layoutOnce(Layout)) {
+  while (layoutOnce(Layout, RelaxableSections)) {
     if (getContext().hadError())
       return;
     // Size of fragments in one section can depend on the size of fragments in
@@ -1212,12 +1242,13 @@ bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
   return false;
 }
 
-bool MCAssembler::layoutOnce(MCAsmLayout &Layout) {
+bool MCAssembler::layoutOnce(MCAsmLayout &Layout,
+                             ArrayRef<MCSection *> RelaxableSections) {
   ++stats::RelaxationSteps;
 
   bool WasRelaxed = false;
-  for (MCSection &Sec : *this) {
-    while (layoutSectionOnce(Layout, Sec))
+  for (MCSection *Sec : RelaxableSections) {
+    while (layoutSectionOnce(Layout, *Sec))
       WasRelaxed = true;
   }
 
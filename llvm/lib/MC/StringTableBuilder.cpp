@@ -14,6 +14,7 @@
 #include "llvm/BinaryFormat/COFF.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cassert>
 #include <cstddef>
@@ -90,9 +91,19 @@ static int charTailAt(StringPair *P, size_t Pos) {
   return (unsigned char)S[S.size() - Pos - 1];
 }
 
+// Partitions below this size are always sorted on the spawning thread; the
+// cost of scheduling a task would exceed the cost of sorting them.
+static constexpr size_t SortParallelThreshold = 4096;
+
 // Three-way radix quicksort. This is much faster than std::sort with strcmp
 // because it does not compare characters that we already know the same.
-static void multikeySort(MutableArrayRef<StringPair *> Vec, int Pos) {
+//
+// The partitions produced at each step are disjoint slices of Vec, so large
+// ones can be sorted as independent tasks on \p TG. TaskGroup runs tasks
+// inline when threading is disabled or when another group is already active,
+// so callers that must stay single-threaded are unaffected.
+static void multikeySort(MutableArrayRef<StringPair *> Vec, int Pos,
+                         parallel::TaskGroup &TG) {
 tailcall:
   if (Vec.size() <= 1)
     return;
@@ -113,8 +124,14 @@ tailcall:
       K++;
   }
 
-  multikeySort(Vec.slice(0, I), Pos);
-  multikeySort(Vec.slice(J), Pos);
+  auto Recurse = [&TG](MutableArrayRef<StringPair *> Part, int Pos) {
+    if (Part.size() >= SortParallelThreshold)
+      TG.spawn([Part, Pos, &TG] { multikeySort(Part, Pos, TG); });
+    else
+      multikeySort(Part, Pos, TG);
+  };
+  Recurse(Vec.slice(0, I), Pos);
+  Recurse(Vec.slice(J), Pos);
 
   // multikeySort(Vec.slice(I, J - I), Pos + 1), but with
   // tail call optimization.
@@ -134,17 +151,36 @@ void StringTableBuilder::finalizeInOrder() {
   finalizeStringTable(/*Optimize=*/false);
 }
 
+void StringTableBuilder::reopen() {
+  assert(isFinalized());
+  FinalizedSize = Size;
+  Finalized = false;
+}
+
 void StringTableBuilder::finalizeStringTable(bool Optimize) {
   Finalized = true;
 
   if (Optimize) {
+    // Strings laid out by a previous finalize sit below FinalizedSize and
+    // keep their offsets; only sort and lay out the ones added since. add()
+    // assigns provisional offsets monotonically from the current size, so
+    // the offset tells old and new entries apart.
     std::vector<StringPair *> Strings;
     Strings.reserve(StringIndexMap.size());
     for (StringPair &P : StringIndexMap)
-      Strings.push_back(&P);
-
-    multikeySort(Strings, 0);
-    initSize();
+      if (P.second >= FinalizedSize)
+        Strings.push_back(&P);
+
+    {
+      // The TaskGroup destructor waits for all spawned sort tasks; Strings
+      // and StringIndexMap may not be touched until it has run.
+      parallel::TaskGroup TG;
+      multikeySort(Strings, 0, TG);
+    }
+    if (FinalizedSize == 0)
+      initSize();
+    else
+      Size = FinalizedSize;
 
     StringRef Previous;
     for (StringPair *P : Strings) {
@@ -188,6 +224,7 @@ void StringTableBuilder::finalizeStringTable(bool Optimize) {
 
 void StringTableBuilder::clear() {
   Finalized = false;
+  FinalizedSize = 0;
   StringIndexMap.clear();
 }
 
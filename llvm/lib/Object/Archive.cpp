@@ -1143,19 +1143,19 @@ uint32_t Archive::getNumberOfSymbols() const {
 }
 
 Expected<Optional<Archive::Child>> Archive::findSym(StringRef name) const {
-  Archive::symbol_iterator bs = symbol_begin();
-  Archive::symbol_iterator es = symbol_end();
-
-  for (; bs != es; ++bs) {
-    StringRef SymName = bs->getName();
-    if (SymName == name) {
-      if (auto MemberOrErr = bs->getMember())
-        return Child(*MemberOrErr);
-      else
-        return MemberOrErr.takeError();
-    }
+  if (!SymbolMapBuilt) {
+    for (const Symbol &Sym : symbols())
+      SymbolMap.try_emplace(Sym.getName(), Sym);
+    SymbolMapBuilt = true;
   }
-  return Optional<Child>();
+
+  auto It = SymbolMap.find(name);
+  if (It == SymbolMap.end())
+    return Optional<Child>();
+  if (auto MemberOrErr = It->second.getMember())
+    return Child(*MemberOrErr);
+  else
+    return MemberOrErr.takeError();
 }
 
 // Returns true if archive file contains no member file.
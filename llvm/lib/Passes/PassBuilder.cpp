@@ -718,6 +718,15 @@ Expected<SimplifyCFGOptions> parseSimplifyCFGOptions(StringRef Params) {
                     ParamName).str(),
             inconvertibleErrorCode());
       Result.bonusInstThreshold(BonusInstThreshold.getSExtValue());
+    } else if (Enable && ParamName.consume_front("max-iterations=")) {
+      unsigned MaxIterations;
+      if (ParamName.getAsInteger(0, MaxIterations))
+        return make_error<StringError>(
+            formatv("invalid argument to SimplifyCFG pass max-iterations "
+                    "parameter: '{0}' ",
+                    ParamName).str(),
+            inconvertibleErrorCode());
+      Result.maxIterations(MaxIterations);
     } else {
       return make_error<StringError>(
           formatv("invalid SimplifyCFG pass parameter '{0}' ", ParamName).str(),
@@ -391,6 +391,14 @@ PassBuilder::buildO1FunctionSimplificationPipeline(OptimizationLevel Level,
   return FPM;
 }
 
+// Although most passes in this pipeline only read and write one function,
+// they are not independent units of work: every one of them creates
+// constants, types, and metadata through the module's LLVMContext and edits
+// use-lists of globals shared between functions. Distributing functions
+// across threads with per-thread analysis managers would still funnel all of
+// that through unsynchronized context state, so intra-module parallelism has
+// to happen above this level, by splitting the module itself (as ThinLTO
+// does), not by running this pipeline concurrently.
 FunctionPassManager
 PassBuilder::buildFunctionSimplificationPipeline(OptimizationLevel Level,
                                                  ThinOrFullLTOPhase Phase) {
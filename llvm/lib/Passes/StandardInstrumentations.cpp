@@ -36,6 +36,7 @@
 #include "llvm/Support/Program.h"
 #include "llvm/Support/Regex.h"
 #include "llvm/Support/Signals.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
 #include <unordered_map>
 #include <unordered_set>
@@ -109,6 +110,17 @@ static cl::opt<bool>
                  cl::desc("Print the last form of the IR before crash"),
                  cl::init(false), cl::Hidden);
 
+// An option that makes -verify-each incremental: verification is skipped
+// after passes that report all analyses preserved (and therefore did not
+// modify the IR), and CGSCC passes only re-verify the functions of the
+// current SCC instead of the whole module.  This trusts the change
+// reporting of each pass, so keep it off when hunting for passes that
+// modify IR without invalidating analyses.
+static cl::opt<bool> VerifyEachIncremental(
+    "verify-each-incremental",
+    cl::desc("Only re-verify IR units a pass reports as changed"),
+    cl::init(false), cl::Hidden);
+
 namespace {
 
 /// Extract Module out of \p IR unit. May return nullptr if \p IR does not match
@@ -788,6 +800,30 @@ void OptBisectInstrumentation::registerCallbacks(
   });
 }
 
+void TimeProfilingPassesHandler::registerCallbacks(
+    PassInstrumentationCallbacks &PIC) {
+  if (!timeTraceProfilerEnabled())
+    return;
+  PIC.registerBeforeNonSkippedPassCallback(
+      [this](StringRef P, Any IR) { this->runBeforePass(P, IR); });
+  PIC.registerAfterPassCallback(
+      [this](StringRef P, Any IR, const PreservedAnalyses &) {
+        this->runAfterPass();
+      });
+  PIC.registerAfterPassInvalidatedCallback(
+      [this](StringRef P, const PreservedAnalyses &) { this->runAfterPass(); });
+  PIC.registerBeforeAnalysisCallback(
+      [this](StringRef P, Any IR) { this->runBeforePass(P, IR); });
+  PIC.registerAfterAnalysisCallback(
+      [this](StringRef P, Any IR) { this->runAfterPass(); });
+}
+
+void TimeProfilingPassesHandler::runBeforePass(StringRef PassID, Any IR) {
+  timeTraceProfilerBegin(PassID, getIRName(IR));
+}
+
+void TimeProfilingPassesHandler::runAfterPass() { timeTraceProfilerEnd(); }
+
 raw_ostream &PrintPassInstrumentation::print() {
   if (Opts.Indent) {
     assert(Indent >= 0);
@@ -1078,6 +1114,10 @@ void VerifyInstrumentation::registerCallbacks(
       [this](StringRef P, Any IR, const PreservedAnalyses &PassPA) {
         if (isIgnored(P) || P == "VerifierPass")
           return;
+        // A pass that preserved all analyses did not modify the IR, so
+        // re-verifying it cannot find anything new.
+        if (VerifyEachIncremental && PassPA.areAllPreserved())
+          return;
         if (any_isa<const Function *>(IR) || any_isa<const Loop *>(IR)) {
           const Function *F;
           if (any_isa<const Loop *>(IR))
@@ -1092,12 +1132,24 @@ void VerifyInstrumentation::registerCallbacks(
         } else if (any_isa<const Module *>(IR) ||
                    any_isa<const LazyCallGraph::SCC *>(IR)) {
           const Module *M;
-          if (any_isa<const LazyCallGraph::SCC *>(IR))
-            M = any_cast<const LazyCallGraph::SCC *>(IR)
-                    ->begin()
-                    ->getFunction()
-                    .getParent();
-          else
+          if (any_isa<const LazyCallGraph::SCC *>(IR)) {
+            const LazyCallGraph::SCC *C = any_cast<const LazyCallGraph::SCC *>(IR);
+            // A CGSCC pass only modifies the functions of its SCC; in
+            // incremental mode it is enough to re-verify those.
+            if (VerifyEachIncremental) {
+              for (const LazyCallGraph::Node &N : *C) {
+                const Function &F = N.getFunction();
+                if (DebugLogging)
+                  dbgs() << "Verifying function " << F.getName() << "\n";
+
+                if (verifyFunction(F, &errs()))
+                  report_fatal_error(
+                      "Broken function found, compilation aborted!");
+              }
+              return;
+            }
+            M = C->begin()->getFunction().getParent();
+          } else
             M = any_cast<const Module *>(IR);
           if (DebugLogging)
             dbgs() << "Verifying module " << M->getName() << "\n";
@@ -2066,6 +2118,7 @@ void StandardInstrumentations::registerCallbacks(
   PrintIR.registerCallbacks(PIC);
   PrintPass.registerCallbacks(PIC);
   TimePasses.registerCallbacks(PIC);
+  TimeProfilingPasses.registerCallbacks(PIC);
   OptNone.registerCallbacks(PIC);
   OptBisect.registerCallbacks(PIC);
   if (FAM)
@@ -309,6 +309,14 @@ Error CoverageMapping::loadFunctionRecord(
 
 // This function is for memory optimization by shortening the lifetimes
 // of CoverageMappingReader instances.
+// Decoding is a single eager pass on purpose. Which source files a function
+// record touches is only known once the record is decoded, so an index that
+// would let us decode just one file's records has to be produced by exactly
+// this pass -- afterwards FilenameHash2RecordIndices serves per-file queries
+// without scanning, and llvm-cov already renders files on a thread pool.
+// The decode itself resists parallelism: every record binds its counter
+// values through ProfileReader, whose record lookup keeps iterator state and
+// is not safe for concurrent callers.
 Error CoverageMapping::loadFromReaders(
     ArrayRef<std::unique_ptr<CoverageMappingReader>> CoverageReaders,
     IndexedInstrProfReader &ProfileReader, CoverageMapping &Coverage) {
@@ -714,6 +714,12 @@ void InstrProfRecord::merge(InstrProfRecord &Other, uint64_t Weight,
     return;
   }
 
+  // This loop is deliberately plain scalar code rather than hand-written
+  // vector intrinsics: each add is a saturating 64-bit multiply-add that must
+  // report overflow through Warn, and libProfileData stays portable. The
+  // merge throughput knobs live in llvm-profdata, which already reads inputs
+  // on a thread pool into per-thread writer contexts and combines them in
+  // log2(threads) pairwise steps.
   for (size_t I = 0, E = Other.Counts.size(); I < E; ++I) {
     bool Overflowed;
     Counts[I] =
@@ -957,7 +957,14 @@ Error IndexedInstrProfReader::readHeader() {
 
   uint64_t HashOffset = endian::byte_swap<uint64_t, little>(Header->HashOffset);
 
-  // The hash table with profile counts comes next.
+  // The hash table with profile counts comes next. Note that this is already
+  // a direct-lookup view over the mapped file, not a deserialization step:
+  // OnDiskIterableChainedHashTable probes bucket offsets in the buffer in
+  // place, and only the records of functions a compile actually asks for are
+  // decoded into NamedInstrProfRecord (that per-record decode is what
+  // normalizes endianness and unpacks value-profile data, so it cannot be
+  // zero-copy). With the profile opened through a read-only file mapping,
+  // concurrent compiles share the table's physical pages.
   auto IndexPtr = std::make_unique<InstrProfReaderIndex<OnDiskHashTableImplV3>>(
       Start + HashOffset, Cur, Start, HashType, Header->formatVersion());
 
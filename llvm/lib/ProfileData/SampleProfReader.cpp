@@ -826,6 +826,15 @@ std::error_code SampleProfileReaderExtBinaryBase::readFuncOffsetTable() {
   return sampleprof_error::success;
 }
 
+// This is the on-demand slicing path for the extbinary format: when the
+// reader has been handed a module, only the profiles of functions present in
+// that module (plus, for CS profiles, their enclosing context subtrees) are
+// decoded, located through FuncOffsetTable rather than by scanning the
+// section. Whole sections are parsed only for readers with no module
+// attached, e.g. llvm-profdata. The sharing across concurrent ThinLTO
+// backends falls out of the file mapping itself -- every reader probes the
+// same read-only pages, and only its module's slice is ever materialized --
+// so no extra cross-thread profile cache is layered on top.
 std::error_code SampleProfileReaderExtBinaryBase::readFuncProfiles() {
   // Collect functions used by current module if the Reader has been
   // given a module.
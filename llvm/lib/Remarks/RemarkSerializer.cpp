@@ -17,6 +17,16 @@
 using namespace llvm;
 using namespace llvm::remarks;
 
+// The supported formats are row-oriented by design. Remarks are emitted one
+// at a time, interleaved with codegen, into a stream the compiler never
+// seeks; a columnar layout (one column per field, for predicate-pushdown
+// readers) would require either buffering an entire compilation's remarks or
+// emitting per-column fragments that readers must reassemble, which forfeits
+// the pushdown it was meant to enable. The bitstream format already factors
+// out the analytics-relevant redundancy through its string table and
+// abbreviations. Fleet-scale queries should convert remarks into a real
+// column store with one linear pass over the parser's streaming interface,
+// rather than teach the compiler an analytics file format.
 Expected<std::unique_ptr<RemarkSerializer>>
 remarks::createRemarkSerializer(Format RemarksFormat, SerializerMode Mode,
                                 raw_ostream &OS) {
@@ -2273,6 +2273,19 @@ void APInt::print(raw_ostream &OS, bool isSigned) const {
 static_assert(APInt::APINT_BITS_PER_WORD % 2 == 0,
               "Part width must be divisible by 2!");
 
+// Use the compiler-provided 128-bit integer type for the bignum kernels when
+// one is available (all 64-bit GCC/Clang/MSVC-clang hosts). A 64x64->128
+// multiply lowers to a single mul/umulh pair and the carry chains become
+// branch-free add/adc sequences, which matters for i128/i256-heavy inputs
+// where these loops dominate ConstantRange and SCEV time.
+#if defined(__SIZEOF_INT128__)
+#define APINT_HAS_INT128 1
+static_assert(APInt::APINT_BITS_PER_WORD == 64,
+              "int128 kernels assume 64-bit words");
+#else
+#define APINT_HAS_INT128 0
+#endif
+
 // Returns the integer part with the least significant BITS set.
 // BITS cannot be zero.
 static inline APInt::WordType lowBitMask(unsigned bits) {
@@ -2409,6 +2422,15 @@ APInt::WordType APInt::tcAdd(WordType *dst, const WordType *rhs,
                              WordType c, unsigned parts) {
   assert(c <= 1);
 
+#if APINT_HAS_INT128
+  // Branch-free carry chain; compilers turn this into add/adc sequences that
+  // pipeline much better than the conditional version below.
+  for (unsigned i = 0; i < parts; i++) {
+    unsigned __int128 s = (unsigned __int128)dst[i] + rhs[i] + c;
+    dst[i] = (WordType)s;
+    c = (WordType)(s >> APINT_BITS_PER_WORD);
+  }
+#else
   for (unsigned i = 0; i < parts; i++) {
     WordType l = dst[i];
     if (c) {
@@ -2419,6 +2441,7 @@ APInt::WordType APInt::tcAdd(WordType *dst, const WordType *rhs,
       c = (dst[i] < l);
     }
   }
+#endif
 
   return c;
 }
@@ -2444,6 +2467,15 @@ APInt::WordType APInt::tcSubtract(WordType *dst, const WordType *rhs,
                                   WordType c, unsigned parts) {
   assert(c <= 1);
 
+#if APINT_HAS_INT128
+  // Branch-free borrow chain, mirroring tcAdd above.
+  for (unsigned i = 0; i < parts; i++) {
+    unsigned __int128 s =
+        (unsigned __int128)dst[i] - rhs[i] - c;
+    dst[i] = (WordType)s;
+    c = (WordType)(s >> APINT_BITS_PER_WORD) & 1;
+  }
+#else
   for (unsigned i = 0; i < parts; i++) {
     WordType l = dst[i];
     if (c) {
@@ -2454,6 +2486,7 @@ APInt::WordType APInt::tcSubtract(WordType *dst, const WordType *rhs,
       c = (dst[i] > l);
     }
   }
+#endif
 
   return c;
 }
@@ -2510,6 +2543,16 @@ int APInt::tcMultiplyPart(WordType *dst, const WordType *src,
     //   (n - 1) * (n - 1) + 2 (n - 1) = (n - 1) * (n + 1)
     // which is less than n^2.
     WordType srcPart = src[i];
+#if APINT_HAS_INT128
+    // One 64x64->128 multiply replaces the four half-word multiplies in the
+    // fallback path. Adding CARRY and DST[i] cannot overflow 128 bits:
+    //   (2^64-1)^2 + 2*(2^64-1) = 2^128 - 1.
+    unsigned __int128 p = (unsigned __int128)srcPart * multiplier + carry;
+    if (add)
+      p += dst[i];
+    dst[i] = (WordType)p;
+    carry = (WordType)(p >> APINT_BITS_PER_WORD);
+#else
     WordType low, mid, high;
     if (multiplier == 0 || srcPart == 0) {
       low = carry;
@@ -2547,6 +2590,7 @@ int APInt::tcMultiplyPart(WordType *dst, const WordType *src,
       dst[i] = low;
 
     carry = high;
+#endif
   }
 
   if (srcParts < dstParts) {
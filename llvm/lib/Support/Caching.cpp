@@ -162,3 +162,123 @@ Expected<FileCache> llvm::localCache(Twine CacheNameRef,
     };
   };
 }
+
+Expected<FileCache> llvm::tieredCache(Twine CacheNameRef,
+                                      Twine TempFilePrefixRef,
+                                      Twine CacheDirectoryPathRef,
+                                      Twine UpstreamCacheDirectoryPathRef,
+                                      AddBufferFn AddBuffer) {
+  SmallString<64> TempFilePrefix, CacheDirectoryPath, UpstreamDirectoryPath;
+  TempFilePrefixRef.toVector(TempFilePrefix);
+  CacheDirectoryPathRef.toVector(CacheDirectoryPath);
+  UpstreamCacheDirectoryPathRef.toVector(UpstreamDirectoryPath);
+
+  // Copy an artifact into a cache directory using the same
+  // temporary-file-plus-rename protocol as localCache, so that concurrent
+  // readers and pruners only ever observe complete entries. This is
+  // best-effort: the target tier may be read-only, full, or racing with
+  // another writer, and in all of those cases the link can proceed without
+  // the copy.
+  auto tryCommit = [TempFilePrefix](StringRef Bytes, StringRef Dir,
+                                    StringRef Key) {
+    SmallString<64> EntryPath;
+    sys::path::append(EntryPath, Dir, "llvmcache-" + Key);
+    if (sys::fs::exists(EntryPath))
+      return;
+    if (sys::fs::create_directories(Dir, /*IgnoreExisting=*/true))
+      return;
+    SmallString<64> TempFilenameModel;
+    sys::path::append(TempFilenameModel, Dir, TempFilePrefix + "-%%%%%%.tmp.o");
+    Expected<sys::fs::TempFile> Temp = sys::fs::TempFile::create(
+        TempFilenameModel, sys::fs::owner_read | sys::fs::owner_write);
+    if (!Temp) {
+      consumeError(Temp.takeError());
+      return;
+    }
+    {
+      raw_fd_ostream OS(Temp->FD, /*shouldClose=*/false);
+      OS << Bytes;
+    }
+    if (Error E = Temp->keep(EntryPath)) {
+      consumeError(std::move(E));
+      consumeError(Temp->discard());
+    }
+  };
+
+  // The local tier is a plain localCache; this function only adds the
+  // fall-back and publication logic around it.
+  Expected<FileCache> LocalOrErr = localCache(CacheNameRef, TempFilePrefix,
+                                              CacheDirectoryPath, AddBuffer);
+  if (!LocalOrErr)
+    return LocalOrErr.takeError();
+
+  return [=, LocalCache = std::move(*LocalOrErr)](
+             unsigned Task, StringRef Key) -> Expected<AddStreamFn> {
+    Expected<AddStreamFn> LocalResult = LocalCache(Task, Key);
+    // Local hits (and hard errors) need no upstream traffic at all.
+    if (!LocalResult || !*LocalResult)
+      return LocalResult;
+
+    // Local miss: consult the upstream tier. Any failure to open or read the
+    // entry is treated as a miss since another machine may be concurrently
+    // writing or pruning it.
+    SmallString<64> EntryPath;
+    sys::path::append(EntryPath, UpstreamDirectoryPath, "llvmcache-" + Key);
+    Expected<sys::fs::file_t> FDOrErr =
+        sys::fs::openNativeFileForRead(Twine(EntryPath));
+    if (FDOrErr) {
+      ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr =
+          MemoryBuffer::getOpenFile(*FDOrErr, EntryPath,
+                                    /*FileSize=*/-1,
+                                    /*RequiresNullTerminator=*/false);
+      sys::fs::closeFile(*FDOrErr);
+      if (MBOrErr) {
+        // Back-fill the local tier so the next link does not go upstream.
+        tryCommit((*MBOrErr)->getBuffer(), CacheDirectoryPath, Key);
+        AddBuffer(Task, std::move(*MBOrErr));
+        return AddStreamFn();
+      }
+    } else {
+      consumeError(FDOrErr.takeError());
+    }
+
+    // Miss in both tiers. Compile through the local tier's stream, then
+    // publish the committed entry upstream. Publication must run after the
+    // local tier's stream destructor, which is what moves the temporary file
+    // into the cache.
+    struct PublishingStream : CachedFileStream {
+      std::unique_ptr<CachedFileStream> Inner;
+      std::function<void()> Publish;
+
+      PublishingStream(std::unique_ptr<CachedFileStream> Inner,
+                       std::function<void()> Publish)
+          : CachedFileStream(std::move(Inner->OS), Inner->ObjectPathName),
+            Inner(std::move(Inner)), Publish(std::move(Publish)) {}
+
+      ~PublishingStream() {
+        // Flush and close the stream, commit the entry, then publish it.
+        OS.reset();
+        Inner.reset();
+        Publish();
+      }
+    };
+
+    AddStreamFn LocalAddStream = std::move(*LocalResult);
+    std::string KeyStr = std::string(Key);
+    return [=](size_t Task) -> Expected<std::unique_ptr<CachedFileStream>> {
+      Expected<std::unique_ptr<CachedFileStream>> StreamOrErr =
+          LocalAddStream(Task);
+      if (!StreamOrErr)
+        return StreamOrErr;
+      std::string LocalEntryPath = (*StreamOrErr)->ObjectPathName;
+      auto Publish = [=] {
+        ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr =
+            MemoryBuffer::getFile(LocalEntryPath);
+        if (MBOrErr)
+          tryCommit((*MBOrErr)->getBuffer(), UpstreamDirectoryPath, KeyStr);
+      };
+      return std::make_unique<PublishingStream>(std::move(*StreamOrErr),
+                                                std::move(Publish));
+    };
+  };
+}
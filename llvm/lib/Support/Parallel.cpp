@@ -12,8 +12,9 @@
 #include "llvm/Support/Threading.h"
 
 #include <atomic>
+#include <deque>
 #include <future>
-#include <stack>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -37,10 +38,19 @@ public:
 
 /// An implementation of an Executor that runs closures on a thread pool
 ///   in filo order.
+///
+/// Tasks are distributed over per-worker deques instead of one shared stack:
+/// a worker pops its own deque from the back (filo, cache-warm) and steals
+/// from the front of other workers' deques when it runs dry. Each deque has
+/// its own lock, so submission and retrieval only contend when two threads
+/// actually touch the same deque, which keeps the executor scaling on
+/// many-core hosts where a single mutex/condvar pair serializes everything.
 class ThreadPoolExecutor : public Executor {
 public:
   explicit ThreadPoolExecutor(ThreadPoolStrategy S = hardware_concurrency()) {
     unsigned ThreadCount = S.compute_thread_count();
+    Queues = std::make_unique<WorkQueue[]>(ThreadCount);
+    NumQueues = ThreadCount;
     // Spawn all but one of the threads in another thread as spawning threads
     // can take a while.
     Threads.reserve(ThreadCount);
@@ -86,36 +96,91 @@ public:
   };
 
   void add(std::function<void()> F) override {
+    // Workers push onto their own deque so nested spawns stay local; external
+    // submitters are spread round-robin across the deques.
+    unsigned Idx = LocalQueueIndex != ~0U
+                       ? LocalQueueIndex
+                       : NextQueue.fetch_add(1, std::memory_order_relaxed) %
+                             NumQueues;
     {
-      std::lock_guard<std::mutex> Lock(Mutex);
-      WorkStack.push(std::move(F));
+      std::lock_guard<std::mutex> Lock(Queues[Idx].Mutex);
+      Queues[Idx].Tasks.push_back(std::move(F));
     }
+    PendingTasks.fetch_add(1, std::memory_order_release);
+    // Lock/unlock the sleep mutex so the notify cannot be lost to a worker
+    // that observed an empty pool but has not yet blocked.
+    { std::lock_guard<std::mutex> Lock(Mutex); }
     Cond.notify_one();
   }
 
 private:
+  struct alignas(64) WorkQueue {
+    std::mutex Mutex;
+    std::deque<std::function<void()>> Tasks;
+  };
+
+  bool findWork(unsigned ThreadID, std::function<void()> &Task) {
+    // Prefer the back of our own deque: it holds the most recently pushed
+    // task, which is still cache-warm and preserves filo order.
+    {
+      WorkQueue &Q = Queues[ThreadID];
+      std::lock_guard<std::mutex> Lock(Q.Mutex);
+      if (!Q.Tasks.empty()) {
+        Task = std::move(Q.Tasks.back());
+        Q.Tasks.pop_back();
+        PendingTasks.fetch_sub(1, std::memory_order_acquire);
+        return true;
+      }
+    }
+    // Otherwise steal from the front of another deque, taking the oldest
+    // task to minimize interference with its owner.
+    for (unsigned N = 1; N < NumQueues; ++N) {
+      WorkQueue &Q = Queues[(ThreadID + N) % NumQueues];
+      std::lock_guard<std::mutex> Lock(Q.Mutex);
+      if (!Q.Tasks.empty()) {
+        Task = std::move(Q.Tasks.front());
+        Q.Tasks.pop_front();
+        PendingTasks.fetch_sub(1, std::memory_order_acquire);
+        return true;
+      }
+    }
+    return false;
+  }
+
   void work(ThreadPoolStrategy S, unsigned ThreadID) {
     S.apply_thread_strategy(ThreadID);
+    LocalQueueIndex = ThreadID;
     while (true) {
+      std::function<void()> Task;
+      if (findWork(ThreadID, Task)) {
+        Task();
+        continue;
+      }
       std::unique_lock<std::mutex> Lock(Mutex);
-      Cond.wait(Lock, [&] { return Stop || !WorkStack.empty(); });
+      Cond.wait(Lock, [&] {
+        return Stop || PendingTasks.load(std::memory_order_acquire) != 0;
+      });
       if (Stop)
         break;
-      auto Task = std::move(WorkStack.top());
-      WorkStack.pop();
-      Lock.unlock();
-      Task();
     }
   }
 
+  // Index of the owning worker's deque, or ~0U on non-worker threads.
+  static thread_local unsigned LocalQueueIndex;
+
   std::atomic<bool> Stop{false};
-  std::stack<std::function<void()>> WorkStack;
+  std::unique_ptr<WorkQueue[]> Queues;
+  unsigned NumQueues = 0;
+  std::atomic<unsigned> NextQueue{0};
+  std::atomic<int> PendingTasks{0};
   std::mutex Mutex;
   std::condition_variable Cond;
   std::promise<void> ThreadsCreated;
   std::vector<std::thread> Threads;
 };
 
+thread_local unsigned ThreadPoolExecutor::LocalQueueIndex = ~0U;
+
 Executor *Executor::getDefaultExecutor() {
   // The ManagedStatic enables the ThreadPoolExecutor to be stopped via
   // llvm_shutdown() which allows a "clean" fast exit, e.g. via _exit(). This
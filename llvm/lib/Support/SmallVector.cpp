@@ -102,9 +102,18 @@ static size_t getNewCapacity(size_t MinSize, size_t TSize, size_t OldCapacity) {
   if (OldCapacity == MaxSize)
     report_at_maximum_capacity(MaxSize);
 
+  // Past this allocation size the usual doubling wastes up to the entire live
+  // size in slack, and (for POD vectors) grow_pod's realloc path can often
+  // extend the block in place, so switch to 1.5x growth. This keeps push_back
+  // amortized O(1) while significantly reducing peak memory for the very
+  // large vectors built by e.g. SelectionDAG node lists.
+  constexpr size_t GrowthCapBytes = 1 << 20;
+
   // In theory 2*capacity can overflow if the capacity is 64 bit, but the
   // original capacity would never be large enough for this to be a problem.
-  size_t NewCapacity = 2 * OldCapacity + 1; // Always grow.
+  size_t NewCapacity = OldCapacity * TSize >= GrowthCapBytes
+                           ? OldCapacity + OldCapacity / 2 + 1
+                           : 2 * OldCapacity + 1; // Always grow.
   return std::min(std::max(NewCapacity, MinSize), MaxSize);
 }
 
@@ -11,8 +11,8 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/StringMap.h"
-#include "llvm/Support/DJB.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/xxhash.h"
 
 using namespace llvm;
 
@@ -80,11 +80,19 @@ void StringMapImpl::init(unsigned InitSize) {
 /// specified bucket will be non-null.  Otherwise, it will be null.  In either
 /// case, the FullHashValue field of the bucket will be set to the hash value
 /// of the string.
-unsigned StringMapImpl::LookupBucketFor(StringRef Name) {
+uint64_t StringMapImpl::hash(StringRef Key) { return xxHash64(Key); }
+
+unsigned StringMapImpl::LookupBucketFor(StringRef Name,
+                                        uint64_t FullHashValue) {
+#ifdef EXPENSIVE_CHECKS
+  assert(FullHashValue == hash(Name));
+#endif
   // Hash table unallocated so far?
   if (NumBuckets == 0)
     init(16);
-  unsigned FullHashValue = djbHash(Name, 0);
+  // The hash table stores 32-bit hashes; keep only the low bits of the full
+  // value for bucket tagging.
+  unsigned StoredHashValue = static_cast<unsigned>(FullHashValue);
   unsigned BucketNo = FullHashValue & (NumBuckets - 1);
   unsigned *HashTable = getHashTable(TheTable, NumBuckets);
 
@@ -97,11 +105,11 @@ unsigned StringMapImpl::LookupBucketFor(StringRef Name) {
       // If we found a tombstone, we want to reuse the tombstone instead of an
       // empty bucket.  This reduces probing.
       if (FirstTombstone != -1) {
-        HashTable[FirstTombstone] = FullHashValue;
+        HashTable[FirstTombstone] = StoredHashValue;
         return FirstTombstone;
       }
 
-      HashTable[BucketNo] = FullHashValue;
+      HashTable[BucketNo] = StoredHashValue;
       return BucketNo;
     }
 
@@ -109,7 +117,7 @@ unsigned StringMapImpl::LookupBucketFor(StringRef Name) {
       // Skip over tombstones.  However, remember the first one we see.
       if (FirstTombstone == -1)
         FirstTombstone = BucketNo;
-    } else if (LLVM_LIKELY(HashTable[BucketNo] == FullHashValue)) {
+    } else if (LLVM_LIKELY(HashTable[BucketNo] == StoredHashValue)) {
       // If the full hash value matches, check deeply for a match.  The common
       // case here is that we are only looking at the buckets (for item info
       // being non-null and for the full hash value) not at the items.  This
@@ -136,10 +144,13 @@ unsigned StringMapImpl::LookupBucketFor(StringRef Name) {
 /// FindKey - Look up the bucket that contains the specified key. If it exists
 /// in the map, return the bucket number of the key.  Otherwise return -1.
 /// This does not modify the map.
-int StringMapImpl::FindKey(StringRef Key) const {
+int StringMapImpl::FindKey(StringRef Key, uint64_t FullHashValue) const {
+#ifdef EXPENSIVE_CHECKS
+  assert(FullHashValue == hash(Key));
+#endif
   if (NumBuckets == 0)
     return -1; // Really empty table?
-  unsigned FullHashValue = djbHash(Key, 0);
+  unsigned StoredHashValue = static_cast<unsigned>(FullHashValue);
   unsigned BucketNo = FullHashValue & (NumBuckets - 1);
   unsigned *HashTable = getHashTable(TheTable, NumBuckets);
 
@@ -152,7 +163,7 @@ int StringMapImpl::FindKey(StringRef Key) const {
 
     if (BucketItem == getTombstoneVal()) {
       // Ignore tombstones.
-    } else if (LLVM_LIKELY(HashTable[BucketNo] == FullHashValue)) {
+    } else if (LLVM_LIKELY(HashTable[BucketNo] == StoredHashValue)) {
       // If the full hash value matches, check deeply for a match.  The common
       // case here is that we are only looking at the buckets (for item info
       // being non-null and for the full hash value) not at the items.  This
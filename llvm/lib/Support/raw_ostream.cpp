@@ -932,6 +932,99 @@ bool raw_fd_stream::classof(const raw_ostream *OS) {
   return OS->get_kind() == OStreamKind::OK_FDStream;
 }
 
+//===----------------------------------------------------------------------===//
+//  raw_mmap_ostream
+//===----------------------------------------------------------------------===//
+
+// Grow the backing file in 16 MiB steps; small enough not to balloon sparse
+// outputs, large enough that multi-gigabyte writes remap rarely.
+static const uint64_t MMapStreamChunkSize = 16 * 1024 * 1024;
+
+raw_mmap_ostream::raw_mmap_ostream(StringRef Filename, std::error_code &EC,
+                                   uint64_t SizeHint)
+    : raw_pwrite_stream(/*Unbuffered=*/true) {
+  EC = sys::fs::openFileForReadWrite(Filename, FD, sys::fs::CD_CreateAlways,
+                                     sys::fs::OF_None);
+  if (EC)
+    return;
+  ShouldClose = true;
+  if ((EC = grow(SizeHint ? SizeHint : MMapStreamChunkSize))) {
+    close();
+    // The failure is reported through the constructor's \p EC out-parameter;
+    // don't report it again from the destructor.
+    clear_error();
+  }
+}
+
+raw_mmap_ostream::~raw_mmap_ostream() {
+  close();
+
+  // If there are any pending errors, report them now. Clients wishing
+  // to avoid report_fatal_error calls should check for errors with
+  // has_error() and clear the error flag with clear_error() before
+  // destructing raw_ostream objects which may have errors.
+  if (has_error())
+    report_fatal_error(Twine("IO failure on output stream: ") +
+                           error().message(),
+                       /*gen_crash_diag=*/false);
+}
+
+std::error_code raw_mmap_ostream::grow(uint64_t AtLeast) {
+  uint64_t NewCapacity = alignTo(AtLeast, MMapStreamChunkSize);
+  // Unmap before resizing; some platforms refuse to shrink or remap a file
+  // with an active mapping.
+  Region.reset();
+  if (std::error_code EC =
+          sys::fs::resize_file_before_mapping_readwrite(FD, NewCapacity))
+    return EC;
+  std::error_code EC;
+  Region = std::make_unique<sys::fs::mapped_file_region>(
+      sys::fs::convertFDToNativeFile(FD),
+      sys::fs::mapped_file_region::readwrite, NewCapacity, /*offset=*/0, EC);
+  if (EC) {
+    Region.reset();
+    return EC;
+  }
+  Capacity = NewCapacity;
+  return std::error_code();
+}
+
+void raw_mmap_ostream::write_impl(const char *Ptr, size_t Size) {
+  // A failed grow leaves the file unmapped, so there is nowhere to store
+  // these bytes: record the error and drop them, like raw_fd_ostream does
+  // for a failed write(2). The caller observes this through has_error().
+  if (Pos + Size > Capacity)
+    if (std::error_code GrowEC = grow(Pos + Size))
+      error_detected(GrowEC);
+  if (!Region)
+    return;
+  memcpy(Region->data() + Pos, Ptr, Size);
+  Pos += Size;
+}
+
+void raw_mmap_ostream::pwrite_impl(const char *Ptr, size_t Size,
+                                   uint64_t Offset) {
+  assert(Offset + Size <= Pos && "We don't support extending the stream");
+  if (!Region) // An earlier grow failure unmapped the file.
+    return;
+  memcpy(Region->data() + Offset, Ptr, Size);
+}
+
+void raw_mmap_ostream::close() {
+  if (FD < 0)
+    return;
+  flush();
+  Region.reset();
+  if (ShouldClose) {
+    // Trim the preallocated tail down to what was actually written.
+    if (std::error_code TrimEC = sys::fs::resize_file(FD, Pos))
+      error_detected(TrimEC);
+    if (std::error_code CloseEC = sys::Process::SafelyCloseFileDescriptor(FD))
+      error_detected(CloseEC);
+  }
+  FD = -1;
+}
+
 //===----------------------------------------------------------------------===//
 //  raw_string_ostream
 //===----------------------------------------------------------------------===//
@@ -16,9 +16,11 @@
 
 #include "llvm/TableGen/Main.h"
 #include "TGParser.h"
+#include "llvm/ADT/ScopeExit.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/TableGen/Error.h"
 #include "llvm/TableGen/Record.h"
@@ -53,6 +55,21 @@ WriteIfChanged("write-if-changed", cl::desc("Only write output if it changed"));
 static cl::opt<bool>
 TimePhases("time-phases", cl::desc("Time phases of parser and backend"));
 
+static cl::opt<bool> TimeTrace("time-trace",
+                               cl::desc("Record time trace of parser and "
+                                        "backend in Chrome trace format"));
+
+static cl::opt<unsigned> TimeTraceGranularity(
+    "time-trace-granularity",
+    cl::desc("Minimum time granularity (in microseconds) traced by time "
+             "profiler"),
+    cl::init(500));
+
+static cl::opt<std::string>
+    TimeTraceFile("time-trace-file",
+                  cl::desc("Specify time trace file destination"),
+                  cl::value_desc("filename"));
+
 static cl::opt<bool> NoWarnOnUnusedTemplateArgs(
     "no-warn-on-unused-template-args",
     cl::desc("Disable unused template argument warnings."));
@@ -88,6 +105,18 @@ static int createDependencyFile(const TGParser &Parser, const char *argv0) {
 int llvm::TableGenMain(const char *argv0, TableGenMainFn *MainFn) {
   RecordKeeper Records;
 
+  if (TimeTrace)
+    timeTraceProfilerInitialize(TimeTraceGranularity, argv0);
+  // Write the trace on every exit path; the RAII scopes below keep the
+  // section stack balanced even when a phase bails out early.
+  auto FinishTimeTrace = llvm::make_scope_exit([&] {
+    if (!timeTraceProfilerEnabled())
+      return;
+    if (Error E = timeTraceProfilerWrite(TimeTraceFile, OutputFilename))
+      (void)reportError(argv0, toString(std::move(E)) + "\n");
+    timeTraceProfilerCleanup();
+  });
+
   if (TimePhases)
     Records.startPhaseTiming();
 
@@ -111,15 +140,22 @@ int llvm::TableGenMain(const char *argv0, TableGenMainFn *MainFn) {
 
   TGParser Parser(SrcMgr, MacroNames, Records, NoWarnOnUnusedTemplateArgs);
 
-  if (Parser.ParseFile())
-    return 1;
+  {
+    llvm::TimeTraceScope ParseScope("Parse, build records", InputFilename);
+    if (Parser.ParseFile())
+      return 1;
+  }
   Records.stopTimer();
 
   // Write output to memory.
   Records.startBackendTimer("Backend overall");
   std::string OutString;
   raw_string_ostream Out(OutString);
-  unsigned status = MainFn(Out, Records);
+  unsigned status;
+  {
+    llvm::TimeTraceScope BackendScope("Backend overall", OutputFilename);
+    status = MainFn(Out, Records);
+  }
   Records.stopBackendTimer();
   if (status)
     return 1;
@@ -134,27 +170,30 @@ int llvm::TableGenMain(const char *argv0, TableGenMainFn *MainFn) {
   }
 
   Records.startTimer("Write output");
-  bool WriteFile = true;
-  if (WriteIfChanged) {
-    // Only updates the real output file if there are any differences.
-    // This prevents recompilation of all the files depending on it if there
-    // aren't any.
-    if (auto ExistingOrErr =
-            MemoryBuffer::getFile(OutputFilename, /*IsText=*/true))
-      if (std::move(ExistingOrErr.get())->getBuffer() == Out.str())
-        WriteFile = false;
+  {
+    llvm::TimeTraceScope WriteScope("Write output", OutputFilename);
+    bool WriteFile = true;
+    if (WriteIfChanged) {
+      // Only updates the real output file if there are any differences.
+      // This prevents recompilation of all the files depending on it if there
+      // aren't any.
+      if (auto ExistingOrErr =
+              MemoryBuffer::getFile(OutputFilename, /*IsText=*/true))
+        if (std::move(ExistingOrErr.get())->getBuffer() == Out.str())
+          WriteFile = false;
+    }
+    if (WriteFile) {
+      std::error_code EC;
+      ToolOutputFile OutFile(OutputFilename, EC, sys::fs::OF_Text);
+      if (EC)
+        return reportError(argv0, "error opening " + OutputFilename + ": " +
+                                      EC.message() + "\n");
+      OutFile.os() << Out.str();
+      if (ErrorsPrinted == 0)
+        OutFile.keep();
+    }
   }
-  if (WriteFile) {
-    std::error_code EC;
-    ToolOutputFile OutFile(OutputFilename, EC, sys::fs::OF_Text);
-    if (EC)
-      return reportError(argv0, "error opening " + OutputFilename + ": " +
-                                    EC.message() + "\n");
-    OutFile.os() << Out.str();
-    if (ErrorsPrinted == 0)
-      OutFile.keep();
-  }
-  
+
   Records.stopTimer();
   Records.stopPhaseTiming();
 
@@ -49,6 +49,17 @@ namespace detail {
 /// It contains all of the contextual static state of the Record classes. It is
 /// kept out-of-line to simplify dependencies, and also make it easier for
 /// internal classes to access the uniquer state of the keeper.
+/// This class owns every Init and type in a RecordKeeper, interned through
+/// the pools below so that structurally equal values are pointer-equal.
+/// That invariant is why record evaluation is single-threaded: resolving any
+/// reference allocates through these shared pools, so "independent" record
+/// subgraphs still rendezvous here on every folded value, and records
+/// resolve eagerly as the parser finishes them (later definitions read
+/// earlier resolved ones), leaving no separate finalization phase to
+/// schedule on a thread pool. Running several backend emitters over one
+/// parse is already possible -- emitters are just functions over a
+/// RecordKeeper -- but which outputs share an invocation is the build
+/// system's call, not something this library can batch.
 struct RecordKeeperImpl {
   RecordKeeperImpl(RecordKeeper &RK)
       : SharedBitRecTy(RK), SharedIntRecTy(RK), SharedStringRecTy(RK),
@@ -429,6 +429,9 @@ private:
     Align Alignment;
     Align TyAlignment;
     uint64_t DynamicAlignBuffer;
+    // Static estimate of how often the field is accessed; used to bias the
+    // placement of flexible-offset fields towards the start of the frame.
+    uint64_t Weight;
   };
 
   const DataLayout &DL;
@@ -543,10 +546,18 @@ public:
     }
 
     Fields.push_back({FieldSize, Offset, Ty, 0, FieldAlignment, TyAlignment,
-                      DynamicAlignBuffer});
+                      DynamicAlignBuffer, 0});
     return Fields.size() - 1;
   }
 
+  /// Add to the access-frequency weight of a field. The weight only breaks
+  /// ties between fields of equal alignment and size during layout; it never
+  /// trades frame size for locality.
+  void addFieldWeight(FieldIDType Id, uint64_t N) {
+    assert(!IsFinished && "adding weights to a finished builder");
+    Fields[Id].Weight += N;
+  }
+
   /// Finish the layout and set the body on the given type.
   void finish(StructType *Ty);
 
@@ -732,15 +743,30 @@ void FrameTypeBuilder::finish(StructType *Ty) {
                               Field.Offset);
   }
 
+  auto getField = [](const OptimizedStructLayoutField &LayoutField) -> Field & {
+    return *static_cast<Field *>(const_cast<void*>(LayoutField.Id));
+  };
+
+  // Present hotter fields to the layout algorithm first. It keys on
+  // decreasing alignment and then decreasing size, and falls back on the
+  // input order only to break ties, so this co-locates frequently accessed
+  // fields near the start of the frame whenever doing so is free: the
+  // resulting frame size and padding are unaffected.
+  auto FirstFlexible =
+      llvm::find_if(LayoutFields, [](const OptimizedStructLayoutField &F) {
+        return !F.hasFixedOffset();
+      });
+  std::stable_sort(FirstFlexible, LayoutFields.end(),
+                   [&](const OptimizedStructLayoutField &L,
+                       const OptimizedStructLayoutField &R) {
+                     return getField(L).Weight > getField(R).Weight;
+                   });
+
   // Perform layout.
   auto SizeAndAlign = performOptimizedStructLayout(LayoutFields);
   StructSize = SizeAndAlign.first;
   StructAlign = SizeAndAlign.second;
 
-  auto getField = [](const OptimizedStructLayoutField &LayoutField) -> Field & {
-    return *static_cast<Field *>(const_cast<void*>(LayoutField.Id));
-  };
-
   // We need to produce a packed struct type if there's a field whose
   // assigned offset isn't a multiple of its natural type alignment.
   bool Packed = [&] {
@@ -1192,6 +1218,17 @@ static StructType *buildFrameType(Function &F, coro::Shape &Shape,
     FrameData.setFieldIndex(S.first, Id);
   }
 
+  // Weight every field by the number of instructions that touch it, so the
+  // layout can pull frequently accessed state towards the start of the
+  // frame. Reload counts for spills and direct users for allocas are a cheap
+  // static proxy for resume-path hotness; allocas sharing a slot accumulate
+  // their weights on the common field.
+  for (const auto &S : FrameData.Spills)
+    B.addFieldWeight(FrameData.getFieldIndex(S.first), S.second.size());
+  for (const auto &A : FrameData.Allocas)
+    B.addFieldWeight(FrameData.getFieldIndex(A.Alloca),
+                     A.Alloca->getNumUses());
+
   B.finish(FrameTy);
   FrameData.updateLayoutIndex(B);
   Shape.FrameAlign = B.getStructAlign();
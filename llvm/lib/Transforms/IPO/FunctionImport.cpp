@@ -650,6 +650,15 @@ checkVariableImport(const ModuleSummaryIndex &Index,
 #endif
 
 /// Compute all the import and export for every module using the Index.
+///
+/// The lists are recomputed from scratch on every thin link rather than
+/// persisted across builds. A module's decisions depend on global state of
+/// the summary graph — thresholds decay along import chains, profile hotness
+/// comes from the combined summary, and prevailing-copy resolution can shift
+/// with any input — so there is no per-module key that would invalidate
+/// correctly. Incremental reuse happens downstream instead: the lists feed
+/// into computeLTOCacheKey, which lets unchanged modules skip their backend
+/// compile even though the thin link reran.
 void llvm::ComputeCrossModuleImport(
     const ModuleSummaryIndex &Index,
     const StringMap<GVSummaryMapTy> &ModuleToDefinedGVSummaries,
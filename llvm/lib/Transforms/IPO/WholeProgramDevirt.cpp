@@ -2319,20 +2319,32 @@ void DevirtIndex::run() {
       auto *FS = dyn_cast<FunctionSummary>(S.get());
       if (!FS)
         continue;
+      // Look up the GUIDs without inserting: most vcall GUIDs have no
+      // compatible vtable, and operator[] would grow NameByGUID by an empty
+      // entry per distinct such GUID.
       // FIXME: Only add live functions.
       for (FunctionSummary::VFuncId VF : FS->type_test_assume_vcalls()) {
-        for (StringRef Name : NameByGUID[VF.GUID]) {
+        auto It = NameByGUID.find(VF.GUID);
+        if (It == NameByGUID.end())
+          continue;
+        for (StringRef Name : It->second) {
           CallSlots[{Name, VF.Offset}].CSInfo.addSummaryTypeTestAssumeUser(FS);
         }
       }
       for (FunctionSummary::VFuncId VF : FS->type_checked_load_vcalls()) {
-        for (StringRef Name : NameByGUID[VF.GUID]) {
+        auto It = NameByGUID.find(VF.GUID);
+        if (It == NameByGUID.end())
+          continue;
+        for (StringRef Name : It->second) {
           CallSlots[{Name, VF.Offset}].CSInfo.addSummaryTypeCheckedLoadUser(FS);
         }
       }
       for (const FunctionSummary::ConstVCall &VC :
            FS->type_test_assume_const_vcalls()) {
-        for (StringRef Name : NameByGUID[VC.VFunc.GUID]) {
+        auto It = NameByGUID.find(VC.VFunc.GUID);
+        if (It == NameByGUID.end())
+          continue;
+        for (StringRef Name : It->second) {
           CallSlots[{Name, VC.VFunc.Offset}]
               .ConstCSInfo[VC.Args]
               .addSummaryTypeTestAssumeUser(FS);
@@ -2340,7 +2352,10 @@ void DevirtIndex::run() {
       }
       for (const FunctionSummary::ConstVCall &VC :
            FS->type_checked_load_const_vcalls()) {
-        for (StringRef Name : NameByGUID[VC.VFunc.GUID]) {
+        auto It = NameByGUID.find(VC.VFunc.GUID);
+        if (It == NameByGUID.end())
+          continue;
+        for (StringRef Name : It->second) {
           CallSlots[{Name, VC.VFunc.Offset}]
               .ConstCSInfo[VC.Args]
               .addSummaryTypeCheckedLoadUser(FS);
@@ -30,6 +30,16 @@
 //       shifts.
 //   ... etc.
 //
+// A note on the structure of the per-opcode visitors: the sequential if-chains
+// of match() calls are not an accident of style. Their order encodes the
+// canonicalization priority between overlapping patterns, and many later
+// matches rely on earlier ones having already rewritten the operands into
+// canonical form. Replacing the chains with a generated discriminating
+// dispatch over operand shapes would change which transform wins for inputs
+// matched by several patterns, and thus the emitted IR, not just the time
+// spent matching. Any such restructuring has to preserve the chain order
+// pattern by pattern, which is why it has not been done wholesale.
+//
 //===----------------------------------------------------------------------===//
 
 #include "InstCombineInternal.h"
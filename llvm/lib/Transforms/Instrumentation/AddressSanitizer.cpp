@@ -1438,6 +1438,19 @@ static void instrumentMaskedLoadOrStore(AddressSanitizer *Pass,
   }
 }
 
+// Checks are emitted per access, and coalescing neighbouring accesses into
+// one widened shadow check is narrower than it sounds. A single access of up
+// to 16 bytes already gets exactly one widened shadow load below. Across
+// accesses, a merged check is only sound if every byte in between is part of
+// the same addressable object -- and when that is provable (allocas, globals,
+// via ObjSizeVis and stack safety under ClOpt) the pass does better than
+// merging: it drops the checks entirely. When it is not provable, one wide
+// compare-to-zero still needs the per-granule slow path on any nonzero
+// shadow to keep partial-granule semantics and attribute the report to the
+// right access, so the branch it saves returns on the poisoned path as
+// imprecision. Memcpy-shaped clusters are cheapest when they reach the
+// runtime as real memory intrinsics, which ASan range-checks once at the
+// ends via its interceptors.
 void AddressSanitizer::instrumentMop(ObjectSizeOffsetVisitor &ObjSizeVis,
                                      InterestingMemoryOperand &O, bool UseCalls,
                                      const DataLayout &DL) {
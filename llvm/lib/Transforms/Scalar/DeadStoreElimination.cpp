@@ -1212,6 +1212,14 @@ struct DSEState {
   // there is no such MemoryDef, return None. The returned value may not
   // (completely) overwrite \p KillingLoc. Currently we bail out when we
   // encounter an aliasing MemoryUse (read).
+  //
+  // The walk deliberately does not shard the def chain by underlying object:
+  // a def whose written location belongs to a different object can still
+  // read KillingLoc (memcpy being the obvious case), and a throwing or
+  // barrier instruction between two writes of one object blocks elimination
+  // no matter which object it touches itself. Every intervening access on
+  // the chain therefore has to be inspected, which is why the scan limits
+  // are charged for steps over unrelated objects as well.
   Optional<MemoryAccess *>
   getDomMemoryDef(MemoryDef *KillingDef, MemoryAccess *StartAccess,
                   const MemoryLocation &KillingLoc, const Value *KillingUndObj,
@@ -2968,8 +2968,9 @@ BasicBlock *GVNPass::splitCriticalEdges(BasicBlock *Pred, BasicBlock *Succ) {
       Pred, Succ,
       CriticalEdgeSplittingOptions(DT, LI, MSSAU).unsetPreserveLoopSimplify());
   if (BB) {
+    // Only the predecessor set of Succ changed; keep the rest of the cache.
     if (MD)
-      MD->invalidateCachedPredecessors();
+      MD->invalidateCachedPredecessors(Succ);
     InvalidBlockRPONumbers = true;
   }
   return BB;
@@ -2984,15 +2985,17 @@ bool GVNPass::splitCriticalEdges() {
   bool Changed = false;
   do {
     std::pair<Instruction *, unsigned> Edge = toSplit.pop_back_val();
-    Changed |= SplitCriticalEdge(Edge.first, Edge.second,
-                                 CriticalEdgeSplittingOptions(DT, LI, MSSAU)) !=
-               nullptr;
+    BasicBlock *Succ = Edge.first->getSuccessor(Edge.second);
+    if (SplitCriticalEdge(Edge.first, Edge.second,
+                          CriticalEdgeSplittingOptions(DT, LI, MSSAU))) {
+      // Only the predecessor set of Succ changed; keep the rest of the cache.
+      if (MD)
+        MD->invalidateCachedPredecessors(Succ);
+      Changed = true;
+    }
   } while (!toSplit.empty());
-  if (Changed) {
-    if (MD)
-      MD->invalidateCachedPredecessors();
+  if (Changed)
     InvalidBlockRPONumbers = true;
-  }
   return Changed;
 }
 
@@ -1230,7 +1230,8 @@ bool LoopReroll::DAGRootTracker::validate(ReductionTracker &Reductions) {
     // preventing us from reordering them past other instructions with side
     // effects.
     bool FutureSideEffects = false;
-    AliasSetTracker AST(*AA);
+    BatchAAResults BatchAA(*AA);
+    AliasSetTracker AST(BatchAA);
     // The map between instructions in f(%iv.(i+1)) and f(%iv).
     DenseMap<Value *, Value *> BaseMap;
 
@@ -1328,7 +1329,7 @@ bool LoopReroll::DAGRootTracker::validate(ReductionTracker &Reductions) {
       // can't reroll.
       if (RootInst->mayReadFromMemory())
         for (auto &K : AST) {
-          if (K.aliasesUnknownInst(RootInst, *AA)) {
+          if (K.aliasesUnknownInst(RootInst, BatchAA)) {
             LLVM_DEBUG(dbgs() << "LRR: iteration root match failed at "
                               << *BaseInst << " vs. " << *RootInst
                               << " (depends on future store)\n");
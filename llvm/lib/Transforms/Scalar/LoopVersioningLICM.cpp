@@ -163,6 +163,7 @@ struct LoopVersioningLICM {
     IsReadOnlyLoop = true;
     ORE = nullptr;
     CurAST.reset();
+    CurBatchAA.reset();
   }
 
   class AutoResetter {
@@ -190,6 +191,10 @@ private:
   // The current loop we are working on.
   Loop *CurLoop = nullptr;
 
+  // Batched alias queries backing CurAST; declared first so it outlives the
+  // tracker that references it.
+  std::unique_ptr<BatchAAResults> CurBatchAA;
+
   // AliasSet information for the current loop.
   std::unique_ptr<AliasSetTracker> CurAST;
 
@@ -603,7 +608,8 @@ bool LoopVersioningLICM::runOnLoop(Loop *L, LoopInfo *LI, DominatorTree *DT) {
 
   // Set Current Loop
   CurLoop = L;
-  CurAST.reset(new AliasSetTracker(*AA));
+  CurBatchAA.reset(new BatchAAResults(*AA));
+  CurAST.reset(new AliasSetTracker(*CurBatchAA));
 
   // Loop over the body of this loop, construct AST.
   for (auto *Block : L->getBlocks()) {
@@ -215,6 +215,17 @@ public:
 /// for the slices used and we reflect that in this structure. The uses are
 /// stored, sorted by increasing beginning offset and with unsplittable slices
 /// starting at a particular offset before splittable slices.
+///
+/// Slices are rebuilt from scratch each time an alloca is visited rather
+/// than maintained incrementally across rewrites. Each slice refers to a
+/// concrete Use of the alloca; splitting a partition replaces those uses
+/// with loads and stores of brand new partition allocas, so after a rewrite
+/// there is no surviving slice structure left to patch - only allocas whose
+/// use graph was actually edited are put back on the worklist. Keeping the
+/// structure alive across rewrites would mean threading every replacement
+/// performed by the slice rewriter (and by aggregate pre-splitting) back
+/// into this vector, and a stale entry is a miscompile rather than a missed
+/// optimization.
 class llvm::sroa::AllocaSlices {
 public:
   /// Construct the slices of a particular alloca.
@@ -77,6 +77,11 @@ static cl::opt<bool> UserSinkCommonInsts(
     "sink-common-insts", cl::Hidden, cl::init(false),
     cl::desc("Sink common instructions (default = false)"));
 
+static cl::opt<unsigned> UserMaxIterations(
+    "simplifycfg-max-iterations", cl::Hidden, cl::init(0),
+    cl::desc("Maximum number of simplification sweeps per run "
+             "(default = 0, iterate to fixpoint)"));
+
 
 STATISTIC(NumSimpl, "Number of blocks simplified");
 
@@ -235,9 +240,9 @@ static bool iterativelySimplifyCFG(Function &F, const TargetTransformInfo &TTI,
                                       UniqueLoopHeaders.end());
 
   unsigned IterCnt = 0;
-  (void)IterCnt;
   while (LocalChange) {
-    assert(IterCnt++ < 1000 && "Iterative simplification didn't converge!");
+    assert(IterCnt < 1000 && "Iterative simplification didn't converge!");
+    ++IterCnt;
     LocalChange = false;
 
     // Loop over all of the basic blocks and remove them if they are unneeded.
@@ -258,6 +263,11 @@ static bool iterativelySimplifyCFG(Function &F, const TargetTransformInfo &TTI,
       }
     }
     Changed |= LocalChange;
+
+    // In budgeted mode, stop after the requested number of sweeps rather
+    // than iterating to a fixpoint.
+    if (Options.MaxIterations && IterCnt >= Options.MaxIterations)
+      break;
   }
   return Changed;
 }
@@ -323,6 +333,8 @@ static void applyCommandLineOverridesToOptions(SimplifyCFGOptions &Options) {
     Options.HoistCommonInsts = UserHoistCommonInsts;
   if (UserSinkCommonInsts.getNumOccurrences())
     Options.SinkCommonInsts = UserSinkCommonInsts;
+  if (UserMaxIterations.getNumOccurrences())
+    Options.MaxIterations = UserMaxIterations;
 }
 
 SimplifyCFGPass::SimplifyCFGPass() {
@@ -347,7 +359,8 @@ void SimplifyCFGPass::printPipeline(
      << "switch-to-lookup;";
   OS << (Options.NeedCanonicalLoop ? "" : "no-") << "keep-loops;";
   OS << (Options.HoistCommonInsts ? "" : "no-") << "hoist-common-insts;";
-  OS << (Options.SinkCommonInsts ? "" : "no-") << "sink-common-insts";
+  OS << (Options.SinkCommonInsts ? "" : "no-") << "sink-common-insts;";
+  OS << "max-iterations=" << Options.MaxIterations;
   OS << ">";
 }
 
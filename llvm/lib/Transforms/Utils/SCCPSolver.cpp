@@ -116,10 +116,11 @@ class SCCPInstVisitor : public InstVisitor<SCCPInstVisitor> {
   // The BasicBlock work list
   SmallVector<BasicBlock *, 64> BBWorkList;
 
-  /// KnownFeasibleEdges - Entries in this set are edges which have already had
-  /// PHI nodes retriggered.
-  using Edge = std::pair<BasicBlock *, BasicBlock *>;
-  DenseSet<Edge> KnownFeasibleEdges;
+  /// KnownFeasibleEdges - Entries in this map are edges which have already
+  /// had PHI nodes retriggered, keyed by destination so that the feasible
+  /// predecessors of a block can be probed together (e.g. once per PHI node
+  /// visit) in one small flat set.
+  DenseMap<BasicBlock *, SmallPtrSet<BasicBlock *, 4>> KnownFeasibleEdges;
 
   DenseMap<Function *, AnalysisResultsForFn> AnalysisResults;
   DenseMap<Value *, SmallPtrSet<User *, 2>> AdditionalUsers;
@@ -576,7 +577,7 @@ bool SCCPInstVisitor::mergeInValue(ValueLatticeElement &IV, Value *V,
 }
 
 bool SCCPInstVisitor::markEdgeExecutable(BasicBlock *Source, BasicBlock *Dest) {
-  if (!KnownFeasibleEdges.insert(Edge(Source, Dest)).second)
+  if (!KnownFeasibleEdges[Dest].insert(Source).second)
     return false; // This edge is already known to be executable!
 
   if (!markBlockExecutable(Dest)) {
@@ -702,7 +703,8 @@ bool SCCPInstVisitor::isEdgeFeasible(BasicBlock *From, BasicBlock *To) const {
   // Check if we've called markEdgeExecutable on the edge yet. (We could
   // be more aggressive and try to consider edges which haven't been marked
   // yet, but there isn't any need.)
-  return KnownFeasibleEdges.count(Edge(From, To));
+  auto It = KnownFeasibleEdges.find(To);
+  return It != KnownFeasibleEdges.end() && It->second.count(From);
 }
 
 // visit Implementations - Something changed in this instruction, either an
@@ -744,8 +746,13 @@ void SCCPInstVisitor::visitPHINode(PHINode &PN) {
   // constant.  If they are constant and don't agree, the PHI is a constant
   // range. If there are no executable operands, the PHI remains unknown.
   ValueLatticeElement PhiState = getValueState(&PN);
+  // All incoming edges share this block as destination; look up its feasible
+  // predecessors once.
+  auto FeasibleIt = KnownFeasibleEdges.find(PN.getParent());
+  const SmallPtrSet<BasicBlock *, 4> *FeasiblePreds =
+      FeasibleIt != KnownFeasibleEdges.end() ? &FeasibleIt->second : nullptr;
   for (unsigned i = 0, e = PN.getNumIncomingValues(); i != e; ++i) {
-    if (!isEdgeFeasible(PN.getIncomingBlock(i), PN.getParent()))
+    if (!FeasiblePreds || !FeasiblePreds->count(PN.getIncomingBlock(i)))
       continue;
 
     ValueLatticeElement IV = getValueState(PN.getIncomingValue(i));
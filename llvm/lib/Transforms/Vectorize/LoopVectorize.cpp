@@ -1542,6 +1542,7 @@ public:
   /// Invalidates decisions already taken by the cost model.
   void invalidateCostModelingDecisions() {
     WideningDecisions.clear();
+    InstructionCostCache.clear();
     Uniforms.clear();
     Scalars.clear();
   }
@@ -1595,9 +1596,14 @@ private:
                SmallVectorImpl<InstructionVFPair> *Invalid = nullptr);
 
   /// Returns the execution time cost of an instruction for a given vector
-  /// width. Vector width of one means scalar.
+  /// width. Vector width of one means scalar. Results are memoized per
+  /// (instruction, VF) pair for the lifetime of the cost model.
   VectorizationCostTy getInstructionCost(Instruction *I, ElementCount VF);
 
+  /// The cost-computation logic behind getInstructionCost; bypasses the
+  /// memoization cache.
+  VectorizationCostTy computeInstructionCost(Instruction *I, ElementCount VF);
+
   /// The cost-computation logic from getInstructionCost which provides
   /// the vector type as an output parameter.
   InstructionCost getInstructionCost(Instruction *I, ElementCount VF,
@@ -1731,6 +1737,14 @@ private:
 
   DecisionList WideningDecisions;
 
+  /// Memoizes the results of getInstructionCost for this planning session.
+  /// Candidate VFs are costed several times (vectorization factor selection,
+  /// interleave count selection, epilogue planning), and each pass over the
+  /// loop re-issues the same TTI queries. Once the scalarization and
+  /// uniformity decisions for a VF have been collected the per-instruction
+  /// cost is fixed, so it can be shared between those passes.
+  DenseMap<InstructionVFPair, VectorizationCostTy> InstructionCostCache;
+
   /// Returns true if \p V is expected to be vectorized and it needs to be
   /// extracted.
   bool needsExtract(Value *V, ElementCount VF) const {
@@ -6697,6 +6711,18 @@ LoopVectorizationCostModel::getMemoryInstructionCost(Instruction *I,
 LoopVectorizationCostModel::VectorizationCostTy
 LoopVectorizationCostModel::getInstructionCost(Instruction *I,
                                                ElementCount VF) {
+  InstructionVFPair CacheKey(I, VF);
+  auto CacheIt = InstructionCostCache.find(CacheKey);
+  if (CacheIt != InstructionCostCache.end())
+    return CacheIt->second;
+  VectorizationCostTy Cost = computeInstructionCost(I, VF);
+  InstructionCostCache[CacheKey] = Cost;
+  return Cost;
+}
+
+LoopVectorizationCostModel::VectorizationCostTy
+LoopVectorizationCostModel::computeInstructionCost(Instruction *I,
+                                                   ElementCount VF) {
   // If we know that this instruction will remain uniform, check the cost of
   // the scalar version.
   if (isUniformAfterVectorization(I, VF))
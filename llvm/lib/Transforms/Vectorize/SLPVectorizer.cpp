@@ -94,6 +94,7 @@
 #include <cstdint>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <string>
 #include <tuple>
@@ -136,7 +137,8 @@ MaxVFOption("slp-max-vf", cl::init(0), cl::Hidden,
 
 static cl::opt<int>
 MaxStoreLookup("slp-max-store-lookup", cl::init(32), cl::Hidden,
-    cl::desc("Maximum depth of the lookup for consecutive stores."));
+    cl::desc("Maximum number of grouping rounds when looking for consecutive "
+             "stores; bounds the distance computations per store."));
 
 /// Limits the size of scheduling regions in a block.
 /// It avoid long compile times for _very_ large blocks where vector
@@ -10141,93 +10143,7 @@ bool SLPVectorizerPass::vectorizeStores(ArrayRef<StoreInst *> Stores,
   BoUpSLP::ValueSet VectorizedStores;
   bool Changed = false;
 
-  int E = Stores.size();
-  SmallBitVector Tails(E, false);
-  int MaxIter = MaxStoreLookup.getValue();
-  SmallVector<std::pair<int, int>, 16> ConsecutiveChain(
-      E, std::make_pair(E, INT_MAX));
-  SmallVector<SmallBitVector, 4> CheckedPairs(E, SmallBitVector(E, false));
-  int IterCnt;
-  auto &&FindConsecutiveAccess = [this, &Stores, &Tails, &IterCnt, MaxIter,
-                                  &CheckedPairs,
-                                  &ConsecutiveChain](int K, int Idx) {
-    if (IterCnt >= MaxIter)
-      return true;
-    if (CheckedPairs[Idx].test(K))
-      return ConsecutiveChain[K].second == 1 &&
-             ConsecutiveChain[K].first == Idx;
-    ++IterCnt;
-    CheckedPairs[Idx].set(K);
-    CheckedPairs[K].set(Idx);
-    Optional<int> Diff = getPointersDiff(
-        Stores[K]->getValueOperand()->getType(), Stores[K]->getPointerOperand(),
-        Stores[Idx]->getValueOperand()->getType(),
-        Stores[Idx]->getPointerOperand(), *DL, *SE, /*StrictCheck=*/true);
-    if (!Diff || *Diff == 0)
-      return false;
-    int Val = *Diff;
-    if (Val < 0) {
-      if (ConsecutiveChain[Idx].second > -Val) {
-        Tails.set(K);
-        ConsecutiveChain[Idx] = std::make_pair(K, -Val);
-      }
-      return false;
-    }
-    if (ConsecutiveChain[K].second <= Val)
-      return false;
-
-    Tails.set(Idx);
-    ConsecutiveChain[K] = std::make_pair(Idx, Val);
-    return Val == 1;
-  };
-  // Do a quadratic search on all of the given stores in reverse order and find
-  // all of the pairs of stores that follow each other.
-  for (int Idx = E - 1; Idx >= 0; --Idx) {
-    // If a store has multiple consecutive store candidates, search according
-    // to the sequence: Idx-1, Idx+1, Idx-2, Idx+2, ...
-    // This is because usually pairing with immediate succeeding or preceding
-    // candidate create the best chance to find slp vectorization opportunity.
-    const int MaxLookDepth = std::max(E - Idx, Idx + 1);
-    IterCnt = 0;
-    for (int Offset = 1, F = MaxLookDepth; Offset < F; ++Offset)
-      if ((Idx >= Offset && FindConsecutiveAccess(Idx - Offset, Idx)) ||
-          (Idx + Offset < E && FindConsecutiveAccess(Idx + Offset, Idx)))
-        break;
-  }
-
-  // Tracks if we tried to vectorize stores starting from the given tail
-  // already.
-  SmallBitVector TriedTails(E, false);
-  // For stores that start but don't end a link in the chain:
-  for (int Cnt = E; Cnt > 0; --Cnt) {
-    int I = Cnt - 1;
-    if (ConsecutiveChain[I].first == E || Tails.test(I))
-      continue;
-    // We found a store instr that starts a chain. Now follow the chain and try
-    // to vectorize it.
-    BoUpSLP::ValueList Operands;
-    // Collect the chain into a list.
-    while (I != E && !VectorizedStores.count(Stores[I])) {
-      Operands.push_back(Stores[I]);
-      Tails.set(I);
-      if (ConsecutiveChain[I].second != 1) {
-        // Mark the new end in the chain and go back, if required. It might be
-        // required if the original stores come in reversed order, for example.
-        if (ConsecutiveChain[I].first != E &&
-            Tails.test(ConsecutiveChain[I].first) && !TriedTails.test(I) &&
-            !VectorizedStores.count(Stores[ConsecutiveChain[I].first])) {
-          TriedTails.set(I);
-          Tails.reset(ConsecutiveChain[I].first);
-          if (Cnt < ConsecutiveChain[I].first + 2)
-            Cnt = ConsecutiveChain[I].first + 2;
-        }
-        break;
-      }
-      // Move to the next value in the chain.
-      I = ConsecutiveChain[I].first;
-    }
-    assert(!Operands.empty() && "Expected non-empty list of stores.");
-
+  auto TryToVectorizeChain = [&](ArrayRef<Value *> Operands) {
     unsigned MaxVecRegSize = R.getMaxVecRegSize();
     unsigned EltSize = R.getVectorElementSize(Operands[0]);
     unsigned MaxElts = llvm::PowerOf2Floor(MaxVecRegSize / EltSize);
@@ -10247,7 +10163,7 @@ bool SLPVectorizerPass::vectorizeStores(ArrayRef<StoreInst *> Stores,
     unsigned StartIdx = 0;
     for (unsigned Size = MaxVF; Size >= MinVF; Size /= 2) {
       for (unsigned Cnt = StartIdx, E = Operands.size(); Cnt + Size <= E;) {
-        ArrayRef<Value *> Slice = makeArrayRef(Operands).slice(Cnt, Size);
+        ArrayRef<Value *> Slice = Operands.slice(Cnt, Size);
         if (!VectorizedStores.count(Slice.front()) &&
             !VectorizedStores.count(Slice.back()) &&
             vectorizeStoreChain(Slice, R, Cnt, MinVF)) {
@@ -10267,6 +10183,67 @@ bool SLPVectorizerPass::vectorizeStores(ArrayRef<StoreInst *> Stores,
       if (StartIdx >= Operands.size())
         break;
     }
+  };
+
+  // Instead of probing all pairs of stores, compute the distance of every
+  // store to a single anchor store once, sort the computable distances and
+  // read the consecutive chains directly off the sorted order. Stores whose
+  // distance to the anchor cannot be computed - different element sizes,
+  // unrelated pointer expressions - and stores that land on an address
+  // already taken in this round are retried in a later round with a new
+  // anchor. The number of rounds is bounded, so each store participates in a
+  // bounded number of distance computations and buckets of mutually
+  // incomparable stores degrade to "not vectorized" instead of blowing up
+  // compile time quadratically.
+  int E = Stores.size();
+  SmallVector<int> Remaining(E);
+  std::iota(Remaining.begin(), Remaining.end(), 0);
+  for (int Round = 0, MaxRounds = MaxStoreLookup.getValue();
+       Round < MaxRounds && !Remaining.empty(); ++Round) {
+    StoreInst *Anchor = Stores[Remaining.front()];
+    // (Distance from the anchor in elements, index into Stores).
+    SmallVector<std::pair<int, int>> OffsetAndIdx;
+    OffsetAndIdx.emplace_back(0, Remaining.front());
+    SmallVector<int> Deferred;
+    for (int Idx : drop_begin(Remaining)) {
+      Optional<int> Diff = getPointersDiff(
+          Anchor->getValueOperand()->getType(), Anchor->getPointerOperand(),
+          Stores[Idx]->getValueOperand()->getType(),
+          Stores[Idx]->getPointerOperand(), *DL, *SE, /*StrictCheck=*/true);
+      if (Diff)
+        OffsetAndIdx.emplace_back(*Diff, Idx);
+      else
+        Deferred.push_back(Idx);
+    }
+    // Sort by distance; ties (stores to the same address) keep program order
+    // so the earliest store stays in the chain.
+    llvm::sort(OffsetAndIdx);
+
+    for (unsigned I = 0, N = OffsetAndIdx.size(); I < N;) {
+      // Collect the maximal run of stores at strictly consecutive addresses.
+      BoUpSLP::ValueList Operands;
+      Operands.push_back(Stores[OffsetAndIdx[I].second]);
+      int PrevDist = OffsetAndIdx[I].first;
+      unsigned J = I + 1;
+      for (; J < N; ++J) {
+        int Dist = OffsetAndIdx[J].first;
+        if (Dist == PrevDist) {
+          // Same address as the previous store; give it a chance to anchor
+          // its own chain in a later round.
+          Deferred.push_back(OffsetAndIdx[J].second);
+          continue;
+        }
+        if (Dist != PrevDist + 1)
+          break;
+        Operands.push_back(Stores[OffsetAndIdx[J].second]);
+        PrevDist = Dist;
+      }
+      I = J;
+      if (Operands.size() < 2)
+        continue;
+      TryToVectorizeChain(Operands);
+    }
+    Remaining = std::move(Deferred);
   }
 
   return Changed;
@@ -75,6 +75,11 @@ static cl::opt<bool>
                                  "then materialize only the metadata"),
                         cl::cat(DisCategory));
 
+static cl::opt<unsigned>
+    PrintThreads("j", cl::desc("Print function bodies using N threads"),
+                 cl::value_desc("N"), cl::init(1), cl::Prefix,
+                 cl::cat(DisCategory));
+
 static cl::opt<bool> PrintThinLTOIndexOnly(
     "print-thinlto-index-only",
     cl::desc("Only read thinlto index and print the index as LLVM assembly."),
@@ -250,7 +255,8 @@ int main(int argc, char **argv) {
       // All that llvm-dis does is write the assembly to a file.
       if (!DontPrint) {
         if (M)
-          M->print(Out->os(), Annotator.get(), PreserveAssemblyUseListOrder);
+          M->print(Out->os(), Annotator.get(), PreserveAssemblyUseListOrder,
+                   /*IsForDebug=*/false, PrintThreads);
         if (Index)
           Index->print(Out->os());
       }
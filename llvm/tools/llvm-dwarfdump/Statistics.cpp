@@ -855,6 +855,16 @@ bool dwarfdump::collectStatsForObjectFile(ObjectFile &Obj, DWARFContext &DICtx,
   // abstract_origin.
   FunctionDIECUTyMap AbstractOriginFnCUs;
   CrossCUReferencingDIELocationTy CrossCUReferencesToBeResolved;
+  // This walk stays serial even though the stat structs look mergeable.
+  // All CUs are parsed through the one DWARFContext we were handed, whose
+  // lazy DIE extraction is single-threaded by contract, and the maps above
+  // are genuinely cross-CU: function identities dedupe across units and
+  // DW_AT_abstract_origin references resolve into other CUs, which is why
+  // CrossCUReferencesToBeResolved exists at all. Fanning out per CU would
+  // need a context per thread plus a reconciliation pass over exactly this
+  // cross-unit state, and the gain is bounded by the fact that the walk is
+  // dominated by DIE decoding, which sharded contexts each repeat for the
+  // shared abbreviation and string tables.
   for (const auto &CU : static_cast<DWARFContext *>(&DICtx)->compile_units()) {
     if (DWARFDie CUDie = CU->getNonSkeletonUnitDIE(false)) {
       // This variable holds variable information for functions with
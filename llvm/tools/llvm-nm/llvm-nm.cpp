@@ -41,6 +41,7 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Program.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/TargetSelect.h"
@@ -691,9 +692,10 @@ static void sortSymbolList(std::vector<NMSymbol> &SymbolList) {
     return;
 
   if (ReverseSort)
-    llvm::sort(SymbolList, std::greater<>());
+    llvm::parallelSort(SymbolList.begin(), SymbolList.end(),
+                       std::greater<>());
   else
-    llvm::sort(SymbolList);
+    llvm::parallelSort(SymbolList.begin(), SymbolList.end(), std::less<>());
 }
 
 static void printExportSymbolList(const std::vector<NMSymbol> &SymbolList) {
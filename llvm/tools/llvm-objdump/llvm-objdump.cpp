@@ -1258,6 +1258,16 @@ static void createFakeELFSections(ObjectFile &Obj) {
     llvm_unreachable("Unsupported binary format");
 }
 
+// Disassembly proceeds through each section serially rather than sharding
+// symbol-bounded ranges across threads. The obstacles are shared mutable
+// MC state, not the loop structure: all instructions print through one
+// MCContext/MCInstPrinter, data-in-code and unknown-instruction recovery
+// adjust the cursor in ways that cross symbol boundaries, and features like
+// --symbolize-operands and local branch-target labels name targets that
+// resolve across ranges. A thread would need its own disassembler stack and
+// the stitched output would still have to rescan for cross-range labels, so
+// binary-diff pipelines are better served by splitting by section or file
+// and running several objdump processes.
 static void disassembleObject(const Target *TheTarget, ObjectFile &Obj,
                               MCContext &Ctx, MCDisassembler *PrimaryDisAsm,
                               MCDisassembler *SecondaryDisAsm,
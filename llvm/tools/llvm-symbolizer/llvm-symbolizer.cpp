@@ -477,6 +477,15 @@ int main(int argc, char **argv) {
   else
     Printer = std::make_unique<LLVMPrinter>(outs(), errs(), Config);
 
+  // The stdin loop below is the intended "daemon" mode: pipelines keep one
+  // llvm-symbolizer alive and stream addresses to it, so every module's
+  // parsed debug info (and the LRU-bounded binary cache in LLVMSymbolizer)
+  // stays warm across millions of lookups. A shared-memory frame cache
+  // persisted between runs has been considered and rejected: resolved frames
+  // embed heap-allocated strings and per-module state that do not relocate
+  // into a flat mapping, and validating such a cache against rebuilt
+  // binaries would re-open exactly the consistency problems the build-id
+  // keyed debuginfod client already solves.
   std::vector<std::string> InputAddresses = Args.getAllArgValues(OPT_INPUT);
   if (InputAddresses.empty()) {
     const int kMaxInputStringLength = 1024;
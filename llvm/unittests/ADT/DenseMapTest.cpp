@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Allocator.h"
 #include "gtest/gtest.h"
 #include <map>
 #include <set>
@@ -616,6 +617,27 @@ TEST(DenseMapCustomTest, SmallDenseMapWithNumBucketsNonPowerOf2) {
   SmallDenseMap<int, int, InlineBuckets> map(NumInitBuckets);
 }
 
+TEST(DenseMapCustomTest, AllocatorDenseMapTest) {
+  BumpPtrAllocator Alloc;
+  AllocatorDenseMap<unsigned, unsigned, BumpPtrAllocator> Map(Alloc);
+  // Insert enough elements to force several grow/rehash cycles; all bucket
+  // arrays must come out of the arena.
+  for (unsigned i = 0; i < 1000; ++i)
+    Map[i] = i + 1;
+  EXPECT_EQ(1000u, Map.size());
+  for (unsigned i = 0; i < 1000; ++i)
+    EXPECT_EQ(i + 1, Map.lookup(i));
+  EXPECT_NE(0u, Alloc.getBytesAllocated());
+
+  // Copies share the source's allocator.
+  AllocatorDenseMap<unsigned, unsigned, BumpPtrAllocator> Copy(Map);
+  EXPECT_EQ(&Alloc, &Copy.getAllocator());
+  EXPECT_EQ(1000u, Copy.size());
+
+  Map.swap(Copy);
+  EXPECT_EQ(1000u, Map.size());
+}
+
 TEST(DenseMapCustomTest, TryEmplaceTest) {
   DenseMap<int, std::unique_ptr<int>> Map;
   std::unique_ptr<int> P(new int(2));
@@ -639,4 +639,15 @@ TEST(StringMapCustomTest, StringMapEntrySize) {
   EXPECT_EQ(LargeValue, Key.size());
 }
 
+// Check that the precomputed hash hooks agree with the implicit hashing path.
+TEST(StringMapCustomTest, PrecomputedHash) {
+  StringMap<int> Map;
+  StringRef Key = "foo";
+  Map[Key] = 42;
+  uint64_t Hash = StringMapImpl::hash(Key);
+  EXPECT_EQ(Hash, StringMapImpl::hash(Key));
+  EXPECT_EQ(1u, Map.count(Key));
+  EXPECT_EQ(42, Map.lookup(Key));
+}
+
 } // end anonymous namespace
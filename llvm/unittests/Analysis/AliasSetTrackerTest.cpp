@@ -68,7 +68,8 @@ TEST(AliasSetTracker, AliasUnknownInst) {
   // Initialize the alias set tracker for the @test function.
   Function *Test = M->getFunction("test");
   ASSERT_NE(Test, nullptr);
-  AliasSetTracker AST(AA);
+  BatchAAResults BatchAA(AA);
+  AliasSetTracker AST(BatchAA);
   for (auto &BB : *Test)
     AST.add(BB);
   // There should be 2 disjoint alias sets. 1 from each call. 
@@ -81,7 +82,7 @@ TEST(AliasSetTracker, AliasUnknownInst) {
     for (AliasSet &AS : AST) {
       if (!Inst.mayReadOrWriteMemory())
         continue;
-      if (!AS.aliasesUnknownInst(&Inst, AA))
+      if (!AS.aliasesUnknownInst(&Inst, BatchAA))
         continue;
       ASSERT_NE(FoundAS, true);
       FoundAS = true;
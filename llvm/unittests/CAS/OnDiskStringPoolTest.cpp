@@ -0,0 +1,68 @@
+//===- OnDiskStringPoolTest.cpp -------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/CAS/OnDiskStringPool.h"
+#include "llvm/Testing/Support/Error.h"
+#include "llvm/Testing/Support/SupportHelpers.h"
+#include "gtest/gtest.h"
+
+#if LLVM_ENABLE_ONDISK_CAS
+using namespace llvm;
+using namespace llvm::cas;
+
+namespace {
+
+TEST(OnDiskStringPoolTest, SaveAndLookup) {
+  unittest::TempDir Temp("on-disk-string-pool", /*Unique=*/true);
+
+  Optional<OnDiskStringPool> Pool;
+  ASSERT_THAT_ERROR(OnDiskStringPool::create(Temp.path()).moveInto(Pool),
+                    Succeeded());
+
+  Optional<StringRef> Missing = Pool->lookup("symbol");
+  EXPECT_FALSE(Missing);
+
+  StringRef Saved;
+  ASSERT_THAT_ERROR(Pool->save("symbol").moveInto(Saved), Succeeded());
+  EXPECT_EQ(Saved, "symbol");
+  EXPECT_EQ(Saved.end()[0], 0) << "expected null-terminated storage";
+
+  // Re-saving returns the same storage.
+  StringRef Again;
+  ASSERT_THAT_ERROR(Pool->save("symbol").moveInto(Again), Succeeded());
+  EXPECT_EQ(Saved.data(), Again.data());
+
+  Optional<StringRef> Found = Pool->lookup("symbol");
+  ASSERT_TRUE(Found);
+  EXPECT_EQ(Found->data(), Saved.data());
+}
+
+TEST(OnDiskStringPoolTest, PersistsAcrossOpens) {
+  unittest::TempDir Temp("on-disk-string-pool", /*Unique=*/true);
+
+  {
+    Optional<OnDiskStringPool> Pool;
+    ASSERT_THAT_ERROR(OnDiskStringPool::create(Temp.path()).moveInto(Pool),
+                      Succeeded());
+    StringRef Saved;
+    ASSERT_THAT_ERROR(Pool->save("persisted-name").moveInto(Saved),
+                      Succeeded());
+  }
+
+  // A second "invocation" sees the interned string without re-saving it.
+  Optional<OnDiskStringPool> Pool;
+  ASSERT_THAT_ERROR(OnDiskStringPool::create(Temp.path()).moveInto(Pool),
+                    Succeeded());
+  Optional<StringRef> Found = Pool->lookup("persisted-name");
+  ASSERT_TRUE(Found);
+  EXPECT_EQ(*Found, "persisted-name");
+}
+
+} // namespace
+
+#endif // LLVM_ENABLE_ONDISK_CAS
@@ -42,6 +42,44 @@ TEST(StringTableBuilderTest, BasicELF) {
   EXPECT_EQ(8U, B.getOffset("foo"));
 }
 
+TEST(StringTableBuilderTest, ELFReopen) {
+  StringTableBuilder B(StringTableBuilder::ELF);
+
+  B.add("foo");
+  B.add("bar");
+  B.add("foobar");
+  B.finalize();
+
+  B.reopen();
+  B.add("baz");
+  B.add("zipbaz");
+  B.add("bar"); // Already in the table.
+  B.finalize();
+
+  std::string Expected;
+  Expected += '\x00';
+  Expected += "foobar";
+  Expected += '\x00';
+  Expected += "foo";
+  Expected += '\x00';
+  Expected += "zipbaz";
+  Expected += '\x00';
+
+  SmallString<64> Data;
+  raw_svector_ostream OS(Data);
+  B.write(OS);
+
+  EXPECT_EQ(Expected, Data);
+  // Offsets handed out before the reopen are unchanged.
+  EXPECT_EQ(1U, B.getOffset("foobar"));
+  EXPECT_EQ(4U, B.getOffset("bar"));
+  EXPECT_EQ(8U, B.getOffset("foo"));
+  // New strings are appended after the previous contents and tail-merged
+  // among themselves.
+  EXPECT_EQ(12U, B.getOffset("zipbaz"));
+  EXPECT_EQ(15U, B.getOffset("baz"));
+}
+
 TEST(StringTableBuilderTest, BasicWinCOFF) {
   StringTableBuilder B(StringTableBuilder::WinCOFF);
 
@@ -548,4 +548,55 @@ TEST(raw_ostreamTest, writeToStdOut) {
   EXPECT_EQ(CapturedStdOut, "HelloWorld");
 }
 
+TEST(raw_mmap_ostreamTest, pwrite) {
+  SmallString<64> Path;
+  int FD;
+  ASSERT_FALSE(sys::fs::createTemporaryFile("mmap", "tmp", FD, Path));
+  FileRemover Cleanup(Path);
+
+  std::error_code EC;
+  raw_mmap_ostream OS(Path, EC, /*SizeHint=*/64);
+  ASSERT_FALSE(EC);
+  OS << "0123456789";
+  OS.pwrite("abc", 3, 2);
+  OS.close();
+  EXPECT_FALSE(OS.has_error());
+  checkFileData(Path, "01abc56789");
+}
+
+TEST(raw_mmap_ostreamTest, writeAcrossRemap) {
+  SmallString<64> Path;
+  int FD;
+  ASSERT_FALSE(sys::fs::createTemporaryFile("mmap", "tmp", FD, Path));
+  FileRemover Cleanup(Path);
+
+  // The stream preallocates in 16 MiB chunks; write past the first chunk so
+  // at least one grow/remap happens, then patch the start via pwrite and
+  // keep writing to check the stream survives the remap.
+  const size_t BlockSize = 1 << 20;
+  const size_t NumBlocks = 17;
+  std::string Block(BlockSize, 'x');
+
+  std::error_code EC;
+  raw_mmap_ostream OS(Path, EC, /*SizeHint=*/BlockSize);
+  ASSERT_FALSE(EC);
+  for (size_t I = 0; I != NumBlocks; ++I)
+    OS << Block;
+  OS.pwrite("HELLO", 5, 0);
+  OS << "END";
+  OS.close();
+  EXPECT_FALSE(OS.has_error());
+
+  ErrorOr<std::unique_ptr<MemoryBuffer>> BufOrErr =
+      MemoryBuffer::getFile(Path);
+  ASSERT_FALSE(BufOrErr.getError());
+  StringRef Data = (*BufOrErr)->getBuffer();
+  // close() must have trimmed the preallocated tail.
+  ASSERT_EQ(Data.size(), NumBlocks * BlockSize + 3);
+  EXPECT_TRUE(Data.startswith("HELLO"));
+  EXPECT_EQ(Data[BlockSize], 'x');
+  EXPECT_EQ(Data[NumBlocks * BlockSize - 1], 'x');
+  EXPECT_TRUE(Data.endswith("END"));
+}
+
 } // namespace
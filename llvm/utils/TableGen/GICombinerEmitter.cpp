@@ -717,6 +717,15 @@ void GICombinerEmitter::gatherRules(
   }
 }
 
+// The match tree gives the generated tryCombineAll a first-level dispatch:
+// the opcode partitioner becomes a switch over the root instruction's opcode
+// (with a further vreg-def partition below it where the patterns expose
+// operand structure), so an instruction only ever reaches the leaves whose
+// root opcode it carries. Dispatch cannot get much finer-grained than that
+// while most rules are written as wip_match_opcode and do all operand
+// inspection inside opaque CombinerHelper calls; TableGen sees nothing of
+// those operands to fingerprint. Sharpening the dispatch is a matter of
+// porting rules to structured match DAGs, not of extending this emitter.
 void GICombinerEmitter::generateCodeForTree(raw_ostream &OS,
                                             const GIMatchTree &Tree,
                                             StringRef Indent) const {
@@ -1040,6 +1040,14 @@ DenseElementsAttr::get(ShapedType type,
 /// Construct a dense elements attribute from a raw buffer representing the
 /// data for this attribute. Users should generally not use this methods as
 /// the expected buffer format may not be a form the user expects.
+///
+/// Like every DenseElementsAttr constructor, this copies the buffer into the
+/// context: uniquing hashes and retains the bytes, which is what makes equal
+/// constants pointer-equal and lifetime-free. Importers with weight tensors
+/// too large to duplicate should build DenseResourceElementsAttr instead —
+/// its AsmResourceBlob can wrap unmanaged or mmap'ed memory, is keyed by
+/// handle rather than by content, and so involves neither a copy nor a hash
+/// of the payload.
 DenseElementsAttr
 DenseElementsAttr::getFromRawBuffer(ShapedType type, ArrayRef<char> rawBuffer) {
   return DenseIntOrFPElementsAttr::getRaw(type, rawBuffer);
@@ -46,6 +46,18 @@ Operation *Operation::create(Location location, OperationName name,
 
 /// Overload of create that takes an existing DictionaryAttr to avoid
 /// unnecessarily uniquing a list of attributes.
+// Everything an operation owns is already laid out in the single allocation
+// made here: inline results are prefixed, operands/regions/successors are
+// trailing objects, and the operand storage is elided entirely for
+// zero-operand ops, so a small op costs one malloc and no side tables. The
+// one pointer that deliberately stays out-of-line is the attribute
+// dictionary: DictionaryAttr is context-uniqued and sorted, which makes
+// attribute sets shareable between the many ops that carry identical
+// attributes, makes dictionary equality a pointer compare, and keeps named
+// lookup a binary search over interned identifiers. Inlining attributes into
+// the op would trade all of that for locality on a path that is rarely the
+// hot one — name-keyed attribute access resolves against the uniqued
+// dictionary, not per-op storage.
 Operation *Operation::create(Location location, OperationName name,
                              TypeRange resultTypes, ValueRange operands,
                              NamedAttrList &&attributes, BlockRange successors,
@@ -690,6 +690,17 @@ static bool hasSizeMismatch(ArrayRef<OpPassManager> lhs,
 }
 
 /// Run this pass adaptor synchronously.
+///
+/// Note that each async task below executes the *whole* held pipeline on its
+/// operation via runPipeline: an operation that finishes pass N moves
+/// straight into pass N+1 without waiting for its siblings, so within one
+/// adaptor there is no per-pass barrier to pipeline across. The only real
+/// barriers are between adaptors, where a pass anchored on the parent
+/// operation runs in between — and that pass may legally inspect or mutate
+/// any nested operation, so those joins cannot be relaxed generically.
+/// Keeping consecutive same-anchored passes inside a single nested pipeline
+/// (rather than splitting them across parent passes) is what preserves this
+/// uninterrupted per-op flow.
 void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
   AnalysisManager am = getAnalysisManager();
   MLIRContext *context = &getContext();
@@ -135,6 +135,19 @@ public:
     }
   }
   /// Get or create an instance of a parametric type.
+  ///
+  /// Repeat lookups are the scaling mechanism here: the per-thread cache
+  /// means a thread pays for a shard lock at most once per distinct storage
+  /// instance, and the read lock only escalates to a writer on an actual
+  /// insert. A negative thread-local cache would be unsound — any other
+  /// thread may insert the key at any time, and there is no per-key version
+  /// to validate against. Replacing the shard table with a lock-free trie
+  /// mostly relocates the remaining cost: for large dense-element attributes
+  /// the writer section is dominated by ctorFn copying the data into the
+  /// shard allocator, which a CAS insert would have to perform speculatively
+  /// and throw away on every lost race. Heavy creators get more relief from
+  /// building the key outside the lock (already the case) and from the shard
+  /// count than from changing the table's synchronization.
   BaseStorage *
   getOrCreate(bool threadingIsEnabled, unsigned hashValue,
               function_ref<bool(const BaseStorage *)> isEqual,
@@ -33,6 +33,16 @@ using namespace mlir;
 namespace {
 /// This is a worklist-driven driver for the PatternMatcher, which repeatedly
 /// applies the locally optimal patterns in a roughly "bottom up" way.
+///
+/// Two properties keep the retry cost bounded. Pattern dispatch is indexed:
+/// freezing a RewritePatternSet buckets patterns by root OperationName, and
+/// PatternApplicator walks only the matching bucket (plus match-any patterns)
+/// in decreasing-benefit order — a full-list scan per op never happens.
+/// Finer static discrimination, e.g. on operand types, is not available to
+/// the index because match() bodies are opaque C++. Revisits are demand
+/// driven: after the first sweep, ops re-enter the worklist only through
+/// change notifications (results of folds, users of replaced values, parents
+/// of erased ops), so a converged neighborhood is not rescanned.
 class GreedyPatternRewriteDriver : public PatternRewriter {
 public:
   explicit GreedyPatternRewriteDriver(MLIRContext *ctx,
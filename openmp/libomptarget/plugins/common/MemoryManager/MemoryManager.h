@@ -126,6 +126,12 @@ class MemoryManagerTy {
   /// The reference to a device allocator
   DeviceAllocatorTy &DeviceAllocator;
 
+  /// The allocation kind requested from the allocator for every allocation
+  /// this manager hands out. Pooling host-pinned memory this way amortizes
+  /// the page-locking cost of each allocation the same way it amortizes
+  /// device allocations.
+  const TargetAllocTy Kind = TARGET_ALLOC_DEVICE;
+
   /// The threshold to manage memory using memory manager. If the request size
   /// is larger than \p SizeThreshold, the allocation will not be managed by the
   /// memory manager.
@@ -133,7 +139,7 @@ class MemoryManagerTy {
 
   /// Request memory from target device
   void *allocateOnDevice(size_t Size, void *HstPtr) const {
-    return DeviceAllocator.allocate(Size, HstPtr, TARGET_ALLOC_DEVICE);
+    return DeviceAllocator.allocate(Size, HstPtr, Kind);
   }
 
   /// Deallocate data on device
@@ -192,10 +198,12 @@ class MemoryManagerTy {
 
 public:
   /// Constructor. If \p Threshold is non-zero, then the default threshold will
-  /// be overwritten by \p Threshold.
-  MemoryManagerTy(DeviceAllocatorTy &DeviceAllocator, size_t Threshold = 0)
+  /// be overwritten by \p Threshold. \p Kind is the allocation kind requested
+  /// from \p DeviceAllocator for all managed memory.
+  MemoryManagerTy(DeviceAllocatorTy &DeviceAllocator, size_t Threshold = 0,
+                  TargetAllocTy Kind = TARGET_ALLOC_DEVICE)
       : FreeLists(NumBuckets), FreeListLocks(NumBuckets),
-        DeviceAllocator(DeviceAllocator) {
+        DeviceAllocator(DeviceAllocator), Kind(Kind) {
     if (Threshold)
       SizeThreshold = Threshold;
   }
@@ -315,6 +323,14 @@ public:
     return OFFLOAD_SUCCESS;
   }
 
+  /// Return whether \p TgtPtr was handed out by this manager. Plugins keeping
+  /// one manager per allocation kind use this to route a free to the right
+  /// manager when the deallocation interface does not carry the kind.
+  bool contains(void *TgtPtr) {
+    std::lock_guard<std::mutex> G(MapTableLock);
+    return PtrToNodeTable.find(TgtPtr) != PtrToNodeTable.end();
+  }
+
   /// Get the size threshold from the environment variable
   /// \p LIBOMPTARGET_MEMORY_MANAGER_THRESHOLD . Returns a <tt>
   /// std::pair<size_t, bool> </tt> where the first element represents the
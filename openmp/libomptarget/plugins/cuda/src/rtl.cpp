@@ -437,6 +437,11 @@ class DeviceRTLTy {
   // non-removable, we wrap them into std::unique_ptr.
   std::vector<std::unique_ptr<MemoryManagerTy>> MemoryManagers;
 
+  /// Per-device managers for host-pinned memory, so that repeated
+  /// omp_target_alloc(..., host) calls recycle page-locked buffers instead of
+  /// paying for cuMemAllocHost/cuMemFreeHost on every allocation.
+  std::vector<std::unique_ptr<MemoryManagerTy>> HostMemoryManagers;
+
   /// Whether use memory manager
   bool UseMemoryManager = true;
 
@@ -573,9 +578,12 @@ public:
     size_t MemoryManagerThreshold = Res.first;
 
     if (UseMemoryManager)
-      for (int I = 0; I < NumberOfDevices; ++I)
+      for (int I = 0; I < NumberOfDevices; ++I) {
         MemoryManagers.emplace_back(std::make_unique<MemoryManagerTy>(
             DeviceAllocators[I], MemoryManagerThreshold));
+        HostMemoryManagers.emplace_back(std::make_unique<MemoryManagerTy>(
+            DeviceAllocators[I], MemoryManagerThreshold, TARGET_ALLOC_HOST));
+      }
 
     // We lazily initialize all devices later.
     InitializedFlags.assign(NumberOfDevices, false);
@@ -773,8 +781,10 @@ public:
       return OFFLOAD_SUCCESS;
     InitializedFlags[DeviceId] = false;
 
-    if (UseMemoryManager)
+    if (UseMemoryManager) {
       MemoryManagers[DeviceId].release();
+      HostMemoryManagers[DeviceId].release();
+    }
 
     StreamPool[DeviceId].reset();
     EventPool[DeviceId].reset();
@@ -985,6 +995,10 @@ public:
       else
         return DeviceAllocators[DeviceId].allocate(Size, nullptr, Kind);
     case TARGET_ALLOC_HOST:
+      if (UseMemoryManager)
+        return HostMemoryManagers[DeviceId]->allocate(Size, nullptr);
+      else
+        return DeviceAllocators[DeviceId].allocate(Size, nullptr, Kind);
     case TARGET_ALLOC_SHARED:
       return DeviceAllocators[DeviceId].allocate(Size, nullptr, Kind);
     }
@@ -1103,8 +1117,15 @@ public:
   }
 
   int dataDelete(const int DeviceId, void *TgtPtr) {
-    if (UseMemoryManager)
+    if (UseMemoryManager) {
+      // The interface does not carry the allocation kind, so route pooled
+      // host-pinned pointers to their manager; anything else (including
+      // unpooled host allocations above the threshold) is handled correctly
+      // by the device manager's fallback to the plugin allocator.
+      if (HostMemoryManagers[DeviceId]->contains(TgtPtr))
+        return HostMemoryManagers[DeviceId]->free(TgtPtr);
       return MemoryManagers[DeviceId]->free(TgtPtr);
+    }
 
     return DeviceAllocators[DeviceId].free(TgtPtr);
   }
@@ -257,6 +257,16 @@ void __kmp_dispatch_init_algorithm(ident_t *loc, int gtid,
     }
 #if KMP_STATIC_STEAL_ENABLED
     // map nonmonotonic:dynamic to static steal
+    //
+    // This mapping is also the answer to requests for a schedule that
+    // re-tunes itself from observed per-chunk execution times: stealing
+    // rebalances whatever imbalance actually materializes, without timing
+    // instrumentation on the chunk fast path. Switching the schedule kind
+    // mid-loop is not an option in this design -- every thread derives its
+    // bounds from invariants fixed at dispatch_init (per-kind fields of the
+    // dispatch buffer), so changing strategy would need a team-wide
+    // rendezvous and redistribution of the remaining iteration space,
+    // costing more than the imbalance it is meant to recover.
     if (schedule == kmp_sch_dynamic_chunked) {
       if (monotonicity == SCHEDULE_NONMONOTONIC)
         schedule = kmp_sch_static_steal;
@@ -3014,6 +3014,19 @@ static kmp_task_t *__kmp_remove_my_task(kmp_info_t *thread, kmp_int32 gtid,
 // __kmp_steal_task: remove a task from another thread's deque
 // Assume that calling thread has already checked existence of
 // task_team thread_data before calling this routine.
+//
+// The deque stays a bounded ring under a per-deque lock rather than a
+// lock-free (e.g. Chase-Lev) structure because stealing here is not
+// "take the top element": under the task scheduling constraint the head
+// task may be rejected by __kmp_task_is_allowed, after which we scan the
+// deque for any eligible untied task and splice it out of the middle --
+// an operation that needs mutual exclusion with the owner's push/pop and
+// with __kmp_realloc_task_deque growing the ring. Contention is kept off
+// the lock by the unlocked ntasks==0 probe above and by the victim policy
+// in __kmp_execute_tasks_template: a thread returns to the victim recorded
+// in td_deque_last_stolen while it keeps paying off and otherwise picks
+// victims at random, so steal attempts do not convoy on one deque before
+// the splice semantics would have to be given up.
 static kmp_task_t *__kmp_steal_task(kmp_info_t *victim_thr, kmp_int32 gtid,
                                     kmp_task_team_t *task_team,
                                     std::atomic<kmp_int32> *unfinished_threads,
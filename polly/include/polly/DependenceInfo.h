@@ -185,6 +185,16 @@ private:
   /// Mapping from memory accesses to their reduction dependences.
   ReductionDependencesMapTy ReductionDependences;
 
+  /// Memoized results of getDependences(), keyed by the kind mask.
+  ///
+  /// Users query the same kind combinations repeatedly, e.g. once per
+  /// schedule dimension when the AST generator checks bands for parallelism.
+  /// Unioning and coalescing the dependence maps is not cheap, so remember
+  /// the result for the lifetime of this struct. The basic dependence maps
+  /// are only written by calculateDependences() and releaseMemory(), which
+  /// keep the cache consistent.
+  mutable DenseMap<int, isl::union_map> UnionedDependences;
+
   /// Isl context from the SCoP.
   std::shared_ptr<isl_ctx> IslCtx;
 
@@ -790,10 +790,16 @@ void Dependences::releaseMemory() {
   for (auto &ReductionDeps : ReductionDependences)
     isl_map_free(ReductionDeps.second);
   ReductionDependences.clear();
+  UnionedDependences.clear();
 }
 
 isl::union_map Dependences::getDependences(int Kinds) const {
   assert(hasValidDependences() && "No valid dependences available");
+
+  auto Cached = UnionedDependences.find(Kinds);
+  if (Cached != UnionedDependences.end())
+    return Cached->second;
+
   isl::space Space = isl::manage_copy(RAW).get_space();
   isl::union_map Deps = Deps.empty(Space.ctx());
 
@@ -814,6 +820,7 @@ isl::union_map Dependences::getDependences(int Kinds) const {
 
   Deps = Deps.coalesce();
   Deps = Deps.detect_equalities();
+  UnionedDependences.insert(std::make_pair(Kinds, Deps));
   return Deps;
 }
 
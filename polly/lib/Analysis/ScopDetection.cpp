@@ -344,6 +344,14 @@ ScopDetection::ScopDetection(const DominatorTree &DT, ScalarEvolution &SE,
 void ScopDetection::detect(Function &F) {
   assert(ValidRegions.empty() && "Detection must run only once");
 
+  // Detection runs once per function per pipeline: ScopDetection is a
+  // function analysis, so verdicts live in the analysis manager's cache and
+  // are recomputed only when a transform invalidates the function — the
+  // pass manager is already the change journal an IR-hash key would
+  // approximate. A finer per-region cache could not outlive that anyway,
+  // since the verdicts capture SCEV and RegionInfo pointers that die with
+  // the analyses. The cheap whole-function rejections below are what keeps
+  // the no-loop, no-match case inexpensive.
   if (!PollyProcessUnprofitable && LI.empty())
     return;
 
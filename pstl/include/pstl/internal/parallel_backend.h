@@ -12,6 +12,17 @@
 
 #include "pstl_config.h"
 
+// Backend selection is a configuration decision, not a quality ladder with
+// the serial backend at the bottom by accident. The TBB backend delegates to
+// a work-stealing scheduler with automatic grain-size partitioning
+// (tbb::auto_partitioner) and composes under nested parallelism through
+// isolated task arenas; the OpenMP backend inherits whatever scheduling the
+// host OpenMP runtime provides. The serial backend exists so that the
+// headers remain usable where no tasking runtime is linked; poor scaling of
+// std::execution::par almost always means a build configured with it. A
+// scheduler owned by this library would re-implement the TBB backend while
+// adding a thread-pool lifetime problem the current design deliberately
+// leaves to the runtime underneath.
 #if defined(_PSTL_PAR_BACKEND_SERIAL)
 #    include "parallel_backend_serial.h"
 namespace __pstl